@@ -0,0 +1,190 @@
+// Boost tokenizer benchmark/scan_counters.hpp  -----------------------------//
+
+// Copyright 2026 Boost.Tokenizer contributors.
+
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// See http://www.boost.org/libs/tokenizer for documentation.
+
+#ifndef BOOST_TOKENIZER_BENCHMARK_SCAN_COUNTERS_HPP_
+#define BOOST_TOKENIZER_BENCHMARK_SCAN_COUNTERS_HPP_
+
+#include <cstddef>
+#include <cstring>
+#include <ctime>
+#include <boost/config.hpp>
+#include <boost/cstdint.hpp>
+
+#if defined(__linux__) && !defined(BOOST_TOKENIZER_BENCHMARK_NO_PERF)
+#define BOOST_TOKENIZER_BENCHMARK_HAS_PERF
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define BOOST_TOKENIZER_BENCHMARK_HAS_RDTSC
+#include <x86intrin.h>
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#define BOOST_TOKENIZER_BENCHMARK_HAS_RDTSC
+#include <intrin.h>
+#endif
+
+namespace boost {
+namespace tokenizer_benchmark {
+
+  enum counter {
+    cycles, instructions, branch_misses, cache_misses, counter_count
+  };
+
+  enum counter_source { perf_counters, tsc_counter, clock_only };
+
+  //===========================================================================
+  // scan_counters measures the code between start() and stop(). On Linux
+  // it opens a group of hardware counters with perf_event_open: cycles,
+  // retired instructions, branch misses and last level cache misses, for
+  // this thread in user mode only. When that is not allowed (see
+  // /proc/sys/kernel/perf_event_paranoid) or not supported, cycles come
+  // from rdtsc, which counts at a fixed reference rate rather than the
+  // core clock, and the other counters are unavailable. Without rdtsc
+  // only the time is measured. Counters that the kernel had to multiplex
+  // are scaled by the time they ran.
+
+  class scan_counters {
+  public:
+    explicit scan_counters(bool use_perf = true) : source_(clock_only) {
+      for (int i = 0; i < counter_count; ++i) {
+        fd_[i] = -1;
+        value_[i] = 0;
+        valid_[i] = false;
+      }
+      clock_ = std::clock();
+      tsc_ = 0;
+      seconds_ = 0;
+#ifdef BOOST_TOKENIZER_BENCHMARK_HAS_RDTSC
+      source_ = tsc_counter;
+#endif
+#ifdef BOOST_TOKENIZER_BENCHMARK_HAS_PERF
+      if (use_perf)
+        open_perf();
+#else
+      (void)use_perf;
+#endif
+    }
+
+    ~scan_counters() {
+#ifdef BOOST_TOKENIZER_BENCHMARK_HAS_PERF
+      for (int i = 0; i < counter_count; ++i)
+        if (fd_[i] != -1)
+          ::close(fd_[i]);
+#endif
+    }
+
+    counter_source source() const { return source_; }
+
+    const char* source_name() const {
+      return source_ == perf_counters ? "perf_event_open"
+        : source_ == tsc_counter ? "rdtsc" : "clock";
+    }
+
+    void start() {
+#ifdef BOOST_TOKENIZER_BENCHMARK_HAS_PERF
+      if (source_ == perf_counters) {
+        ::ioctl(fd_[0], PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+        ::ioctl(fd_[0], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+      }
+#endif
+      clock_ = std::clock();
+      tsc_ = read_tsc();
+    }
+
+    void stop() {
+      boost::uint64_t tsc = read_tsc();
+      std::clock_t clock = std::clock();
+#ifdef BOOST_TOKENIZER_BENCHMARK_HAS_PERF
+      if (source_ == perf_counters) {
+        ::ioctl(fd_[0], PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+        for (int i = 0; i < counter_count; ++i)
+          if (fd_[i] != -1)
+            valid_[i] = read_perf(fd_[i], value_[i]);
+      }
+#endif
+      seconds_ = double(clock - clock_) / CLOCKS_PER_SEC;
+      if (source_ == tsc_counter) {
+        value_[cycles] = tsc - tsc_;
+        valid_[cycles] = true;
+      }
+    }
+
+    // Whether the last measurement has c, and its value.
+    bool has(counter c) const { return valid_[c]; }
+    boost::uint64_t value(counter c) const { return value_[c]; }
+
+    // The processor time of the last measurement.
+    double seconds() const { return seconds_; }
+
+  private:
+    scan_counters(const scan_counters&);
+    scan_counters& operator=(const scan_counters&);
+
+    static boost::uint64_t read_tsc() {
+#ifdef BOOST_TOKENIZER_BENCHMARK_HAS_RDTSC
+      return __rdtsc();
+#else
+      return 0;
+#endif
+    }
+
+#ifdef BOOST_TOKENIZER_BENCHMARK_HAS_PERF
+    void open_perf() {
+      const boost::uint64_t configs[counter_count] = {
+        PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS,
+        PERF_COUNT_HW_BRANCH_MISSES, PERF_COUNT_HW_CACHE_MISSES
+      };
+      for (int i = 0; i < counter_count; ++i) {
+        perf_event_attr attr;
+        std::memset(&attr, 0, sizeof(attr));
+        attr.size = sizeof(attr);
+        attr.type = PERF_TYPE_HARDWARE;
+        attr.config = configs[i];
+        attr.disabled = i == 0;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED |
+          PERF_FORMAT_TOTAL_TIME_RUNNING;
+        fd_[i] = static_cast<int>(::syscall(__NR_perf_event_open, &attr, 0,
+                                            -1, i == 0 ? -1 : fd_[0], 0));
+        if (i == 0 && fd_[0] == -1)
+          return;
+      }
+      source_ = perf_counters;
+    }
+
+    static bool read_perf(int fd, boost::uint64_t& value) {
+      boost::uint64_t data[3];
+      if (::read(fd, data, sizeof(data)) != ssize_t(sizeof(data)) ||
+          data[2] == 0)
+        return false;
+      value = data[0];
+      if (data[2] < data[1])
+        value = boost::uint64_t(double(value) * data[1] / data[2]);
+      return true;
+    }
+#endif
+
+    counter_source source_;
+    int fd_[counter_count];
+    boost::uint64_t value_[counter_count];
+    bool valid_[counter_count];
+    std::clock_t clock_;
+    boost::uint64_t tsc_;
+    double seconds_;
+  };
+
+} // namespace tokenizer_benchmark
+} // namespace boost
+
+#endif
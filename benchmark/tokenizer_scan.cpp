@@ -0,0 +1,317 @@
+// Boost tokenizer scan loop benchmark  -------------------------------------//
+
+// Copyright 2026 Boost.Tokenizer contributors.
+
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// See http://www.boost.org for updates, documentation, and revision history.
+
+// Runs each TokenizerFunction model over generated corpora and prints, per
+// byte of input, the cycles, instructions, branch misses and cache misses
+// of its scan loop, as scan_counters measures them:
+//
+//   tokenizer_scan [--size BYTES] [--repeat N] [--tokens] [--no-perf]
+//                  [FILTER]
+//
+// Only the rows whose "model/corpus" name contains FILTER are run. Each
+// row is run N times and the run with the fewest cycles is reported. By
+// default tokens are discarded, so that only the separator is measured;
+// with --tokens each one is built in a std::string, as tokenizer<> does.
+
+#include "scan_counters.hpp"
+
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <boost/cstdint.hpp>
+#include <boost/tokenizer.hpp>
+#include <boost/tokenizer/ascii_word_separator.hpp>
+#include <boost/tokenizer/lenient_escaped_list_separator.hpp>
+#include <boost/tokenizer/line_separator.hpp>
+#include <boost/tokenizer/schema_separator.hpp>
+#include <boost/tokenizer/unicode_separator.hpp>
+#include <boost/tokenizer/word_tokenizer.hpp>
+
+namespace {
+
+  using boost::tokenizer_benchmark::scan_counters;
+
+  struct options {
+    std::size_t size;
+    int repeat;
+    bool tokens;
+    bool perf;
+    const char* filter;
+  };
+
+  //===========================================================================
+  // Corpora. Each is generated from a fixed seed, so runs compare.
+
+  class random_source {
+  public:
+    random_source() : state_(12345) { }
+    unsigned next(unsigned n) {
+      state_ = state_ * 1103515245u + 12345u;
+      return (state_ >> 16) % n;
+    }
+  private:
+    boost::uint32_t state_;
+  };
+
+  std::string word(random_source& r) {
+    std::string w(1 + r.next(9), 'a');
+    for (std::size_t i = 0; i < w.size(); ++i)
+      w[i] = char('a' + r.next(26));
+    return w;
+  }
+
+  std::string number(random_source& r) {
+    char buf[16];
+    std::sprintf(buf, "%u", r.next(100000));
+    return buf;
+  }
+
+  // Comma separated, with quoted fields holding commas and escapes.
+  std::string csv_corpus(std::size_t size) {
+    random_source r;
+    std::string s;
+    while (s.size() < size) {
+      for (int f = 0; f < 8; ++f) {
+        if (f)
+          s += ',';
+        switch (r.next(4)) {
+        case 0: s += number(r); break;
+        case 1: s += '"' + word(r) + ", " + word(r) + '"'; break;
+        case 2: s += word(r) + "\\\"" + word(r); break;
+        default: s += word(r); break;
+        }
+      }
+      s += '\n';
+    }
+    return s;
+  }
+
+  // Tab separated, with some empty fields.
+  std::string tsv_corpus(std::size_t size) {
+    random_source r;
+    std::string s;
+    while (s.size() < size) {
+      for (int f = 0; f < 8; ++f) {
+        if (f)
+          s += '\t';
+        if (r.next(5))
+          s += r.next(2) ? word(r) : number(r);
+      }
+      s += '\n';
+    }
+    return s;
+  }
+
+  // Lines of a server log.
+  std::string log_corpus(std::size_t size) {
+    static const char* levels[] = { "INFO", "WARN", "DEBUG", "ERROR" };
+    random_source r;
+    std::string s;
+    while (s.size() < size) {
+      s += "2026-10-18T12:" + number(r).substr(0, 2) + ":07Z ";
+      s += levels[r.next(4)];
+      s += " [worker-" + number(r).substr(0, 1) + "] ";
+      for (unsigned w = 1 + r.next(6); w; --w)
+        s += word(r) + ' ';
+      s += "id=" + number(r) + " took " + number(r) + "ms\n";
+    }
+    return s;
+  }
+
+  // Records of fields 8, 4, 12 and 6 wide.
+  std::string fixed_corpus(std::size_t size) {
+    random_source r;
+    std::string s;
+    while (s.size() < size) {
+      const std::size_t widths[] = { 8, 4, 12, 6 };
+      for (std::size_t f = 0; f < 4; ++f) {
+        std::string v = word(r) + word(r);
+        v.resize(widths[f], ' ');
+        s += v;
+      }
+    }
+    return s;
+  }
+
+  // Prose, with punctuation.
+  std::string text_corpus(std::size_t size) {
+    static const char* marks[] = { " ", " ", " ", " ", ", ", ". ", "; ",
+                                   "! ", "\n" };
+    random_source r;
+    std::string s;
+    while (s.size() < size)
+      s += word(r) + marks[r.next(9)];
+    return s;
+  }
+
+  //===========================================================================
+  // Measurement.
+
+  template <class TokenizerFunc, class Token>
+  std::size_t scan(const std::string& text, TokenizerFunc& f, Token& tok) {
+    std::size_t n = 0;
+    std::string::const_iterator next = text.begin();
+    std::string::const_iterator end = text.end();
+    f.reset();
+    while (f(next, end, tok))
+      ++n;
+    return n;
+  }
+
+  void print_header(const scan_counters& counters, const options& opt) {
+    std::printf("counters: %s, %s, best of %d\n\n", counters.source_name(),
+                opt.tokens ? "std::string tokens" : "tokens discarded",
+                opt.repeat);
+    std::printf("%-32s %9s %8s %8s %10s %10s %7s\n", "model/corpus",
+                "tokens", "cyc/B", "ins/B", "brmiss/kB", "cmiss/kB",
+                "ns/B");
+  }
+
+  template <class TokenizerFunc>
+  void run(const options& opt, scan_counters& counters, const char* model,
+           const char* corpus, const std::string& text, TokenizerFunc f)
+  {
+    std::string name = std::string(model) + "/" + corpus;
+    if (opt.filter && name.find(opt.filter) == std::string::npos)
+      return;
+
+    std::size_t tokens = 0;
+    bool first = true;
+    boost::uint64_t best_cycles = 0;
+    double best_seconds = 0;
+    boost::uint64_t best[boost::tokenizer_benchmark::counter_count] = {};
+    bool valid[boost::tokenizer_benchmark::counter_count] = {};
+
+    for (int i = 0; i < opt.repeat; ++i) {
+      boost::tokenizer_detail::discard_token discarded;
+      std::string kept;
+      counters.start();
+      tokens = opt.tokens ? scan(text, f, kept) : scan(text, f, discarded);
+      counters.stop();
+
+      boost::uint64_t c = counters.has(boost::tokenizer_benchmark::cycles)
+        ? counters.value(boost::tokenizer_benchmark::cycles) : 0;
+      if (first || c < best_cycles ||
+          (c == 0 && counters.seconds() < best_seconds)) {
+        first = false;
+        best_cycles = c;
+        best_seconds = counters.seconds();
+        for (int k = 0; k < boost::tokenizer_benchmark::counter_count; ++k) {
+          valid[k] = counters.has(boost::tokenizer_benchmark::counter(k));
+          best[k] = counters.value(boost::tokenizer_benchmark::counter(k));
+        }
+      }
+    }
+
+    const double bytes = double(text.size());
+    std::printf("%-32s %9lu", name.c_str(),
+                static_cast<unsigned long>(tokens));
+    const char* formats[] = { " %8.2f", " %8.2f", " %10.2f", " %10.2f" };
+    const int widths[] = { 9, 9, 11, 11 };
+    const double per[] = { bytes, bytes, bytes / 1024, bytes / 1024 };
+    for (int k = 0; k < boost::tokenizer_benchmark::counter_count; ++k) {
+      if (valid[k])
+        std::printf(formats[k], double(best[k]) / per[k]);
+      else
+        std::printf("%*s", widths[k], "-");
+    }
+    std::printf(" %7.3f\n", best_seconds * 1e9 / bytes);
+  }
+
+  bool parse(int argc, char* argv[], options& opt) {
+    opt.size = 8u << 20;
+    opt.repeat = 5;
+    opt.tokens = false;
+    opt.perf = true;
+    opt.filter = 0;
+    for (int i = 1; i < argc; ++i) {
+      if (!std::strcmp(argv[i], "--size") && i + 1 < argc)
+        opt.size = std::strtoul(argv[++i], 0, 10);
+      else if (!std::strcmp(argv[i], "--repeat") && i + 1 < argc)
+        opt.repeat = std::atoi(argv[++i]);
+      else if (!std::strcmp(argv[i], "--tokens"))
+        opt.tokens = true;
+      else if (!std::strcmp(argv[i], "--no-perf"))
+        opt.perf = false;
+      else if (argv[i][0] != '-' && !opt.filter)
+        opt.filter = argv[i];
+      else
+        return false;
+    }
+    return opt.size > 0 && opt.repeat > 0;
+  }
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+  using namespace boost;
+
+  options opt;
+  if (!parse(argc, argv, opt)) {
+    std::fprintf(stderr, "usage: %s [--size BYTES] [--repeat N] [--tokens] "
+                 "[--no-perf] [FILTER]\n", argv[0]);
+    return 2;
+  }
+
+  scan_counters counters(opt.perf);
+  print_header(counters, opt);
+
+  const std::string csv = csv_corpus(opt.size);
+  const std::string tsv = tsv_corpus(opt.size);
+  const std::string log = log_corpus(opt.size);
+  const std::string fixed = fixed_corpus(opt.size);
+  const std::string text = text_corpus(opt.size);
+
+  // Delimited records.
+  run(opt, counters, "escaped_list", "csv", csv,
+      escaped_list_separator<char>("\\", ",\n", "\""));
+  run(opt, counters, "lenient_escaped_list", "csv", csv,
+      lenient_escaped_list_separator<char>(std::string("\\"),
+                                           std::string(",\n"),
+                                           std::string("\"")));
+  run(opt, counters, "char_separator", "csv", csv,
+      char_separator<char>(",\n", "", keep_empty_tokens));
+  run(opt, counters, "char_separator", "tsv", tsv,
+      char_separator<char>("\t\n", "", keep_empty_tokens));
+  run(opt, counters, "char_separator.kept", "tsv", tsv,
+      char_separator<char>("", "\t\n", keep_empty_tokens));
+  run(opt, counters, "line_separator", "tsv", tsv, line_separator<char>());
+
+  // Logs: many delimiters, dropped and kept, are where the chains of
+  // is_dropped and is_kept tests are longest.
+  run(opt, counters, "char_separator", "log", log,
+      char_separator<char>(" \n", "[]=:"));
+  run(opt, counters, "char_separator.many", "log", log,
+      char_separator<char>(" \t\r\n", "[](){}<>=:;,.!?-"));
+  run(opt, counters, "unicode_separator", "log", log,
+      unicode_separator<char>(" \n", "[]=:"));
+  run(opt, counters, "line_separator", "log", log, line_separator<char>());
+
+  // Fixed width records.
+  const int widths[] = { 8, 4, 12, 6 };
+  run(opt, counters, "offset_separator", "fixed", fixed,
+      offset_separator(widths, widths + 4));
+  run(opt, counters, "schema_separator", "fixed", fixed,
+      schema_separator(record_schema().field(8).field(4).field(12)
+                       .field(6)));
+
+  // Words.
+  run(opt, counters, "char_delimiters", "text", text,
+      char_delimiters_separator<char>());
+  run(opt, counters, "word_separator", "text", text, word_separator<char>());
+  run(opt, counters, "ascii_word_separator", "text", text,
+      ascii_word_separator(drop_punctuation));
+  run(opt, counters, "char_separator", "text", text, char_separator<char>());
+
+  return 0;
+}
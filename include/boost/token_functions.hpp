@@ -31,6 +31,7 @@
 #ifndef BOOST_TOKEN_FUNCTIONS_JRB120303_HPP_
 #define BOOST_TOKEN_FUNCTIONS_JRB120303_HPP_
 
+#include <cstddef>
 #include <vector>
 #include <stdexcept>
 #include <string>
@@ -39,6 +40,7 @@
 #include <boost/config.hpp>
 #include <boost/assert.hpp>
 #include <boost/type_traits/conditional.hpp>
+#include <boost/type_traits/integral_constant.hpp>
 #include <boost/type_traits/is_pointer.hpp>
 #include <boost/detail/workaround.hpp>
 #include <boost/throw_exception.hpp>
@@ -77,6 +79,122 @@ namespace std{
 #endif
 
 namespace boost{
+
+  template <class Char, class Traits> class escaped_list_spec;
+  template <class Char, class Tr> class char_separator_spec;
+  template <class Char, class Traits, class ErrorHandler>
+  class lenient_escaped_list_separator;
+  template <class Char, class Tr> class constexpr_char_separator;
+  template <std::size_t N> class constexpr_offset_separator;
+
+  // Whether a token is text between delimiters or a kept delimiter. Token
+  // types that record it, such as tagged_token, are told by the
+  // separators through tokenizer_detail::token_kind_traits.
+  enum token_kind { data_token, delimiter_token };
+
+  namespace tokenizer_detail {
+    template <class TokenizerFunc> class separator_state;
+
+    // A token that ignores everything assigned or appended to it. Passing
+    // one to a TokenizerFunction makes it find the end of the next token
+    // without building it, which is how the models below implement skip.
+    struct discard_token {
+      template <class Iterator>
+      void assign(Iterator, Iterator) { }
+      template <class Value>
+      discard_token& operator+=(const Value&) { return *this; }
+    };
+
+    // An observer for escaped_list_separator that ignores all events.
+    struct null_observer {
+      void escape() { }
+      void quote() { }
+    };
+
+    // Tells a token where it lies in the input, for the separators that
+    // build their tokens with += rather than assign. Most token types do
+    // not record it, so the generic case does nothing.
+    template <class Token>
+    struct token_location_traits {
+      template <class Iterator>
+      static void set(Token&, const Iterator&, const Iterator&) { }
+    };
+
+    // Empties a token before the separators that build it with += start
+    // on the next one. Strings, and tokens that specialize this, are
+    // cleared in place so that they keep the storage they have; others
+    // are assigned a default constructed token.
+    template <class Token>
+    struct token_clear_traits {
+      static void clear(Token& t) { t = Token(); }
+    };
+
+    template <class Char, class Tr, class Alloc>
+    struct token_clear_traits<std::basic_string<Char,Tr,Alloc> > {
+      static void clear(std::basic_string<Char,Tr,Alloc>& t) { t.clear(); }
+    };
+
+    // Where the parsing loop of a separator stands inside a token that the
+    // end of its input has cut in two, so that it can go on with the rest
+    // of the token when more input comes (see push_tokenizer.hpp).
+    struct scan_resume {
+      scan_resume()
+        : in_token(false), in_quote(false), escape(false), taken(0) { }
+
+      // A token has been started.
+      bool in_token;
+      // escaped_list_separator: between an opening and a closing quote.
+      bool in_quote;
+      // escaped_list_separator: the input ended with an escape character.
+      bool escape;
+      // offset_separator: the number of characters of the token so far.
+      unsigned taken;
+    };
+
+    // The input of a parsing loop when the end of its range is the end of
+    // the input, as it is for operator(). The loops that can be pushed are
+    // also run with a push_input (see push_tokenizer.hpp), whose range may
+    // be followed by more input. When more() is true, a loop that reaches
+    // the end of the range inside a token calls one of the cut members to
+    // save where it stands, and returns false; it starts from there when
+    // in_token() is true.
+    struct input_ends {
+      static BOOST_CONSTEXPR bool more() { return false; }
+      static BOOST_CONSTEXPR bool in_token() { return false; }
+      static BOOST_CONSTEXPR bool in_quote() { return false; }
+      static BOOST_CONSTEXPR bool escape() { return false; }
+      static BOOST_CONSTEXPR unsigned taken() { return 0; }
+
+      BOOST_CXX14_CONSTEXPR void cut_token() { }
+      BOOST_CXX14_CONSTEXPR void cut_field(bool, bool) { }
+      BOOST_CXX14_CONSTEXPR void cut_offset(unsigned) { }
+      BOOST_CXX14_CONSTEXPR void cut_character() { }
+    };
+  }
+
+  //===========================================================================
+  // has_token_push tells whether a TokenizerFunction has a member
+  //
+  //   template <class Iterator, class Token, class Input>
+  //   bool push(Iterator& next, Iterator end, Token& tok, Input& in);
+  //
+  // which runs the parsing loop of operator() over input that may go on
+  // past end, as described at tokenizer_detail::input_ends. push_token
+  // uses it to read every character of the input once.
+  template <class TokenizerFunc>
+  struct has_token_push : public false_type { };
+
+  //===========================================================================
+  // has_token_skip tells whether a TokenizerFunction has a member
+  //
+  //   template <class Iterator> bool skip(Iterator& next, Iterator end);
+  //
+  // which behaves like operator() but does not produce the token. It is
+  // specialized for the models in this library; specialize it for your own
+  // TokenizerFunctions to let token_iterator::skip use their skip member.
+  template <class TokenizerFunc>
+  struct has_token_skip : public false_type { };
+
   //===========================================================================
   // The escaped_list_separator class. Which is a model of TokenizerFunction
   // An escaped list is a super-set of what is commonly known as a comma
@@ -91,6 +209,61 @@ namespace boost{
     escaped_list_error(const std::string& what_arg):std::runtime_error(what_arg) { }
   };
 
+  // The errors in escape sequences that escaped_list_error reports.
+  enum escaped_list_errc {
+    no_escape_error = 0,
+    escape_at_end,      // the input ends with an escape character
+    unknown_escape      // the escape character is followed by another one
+  };
+
+  namespace tokenizer_detail {
+    // Reports a bad escape sequence [first, last) of escaped_list_separator
+    // by throwing escaped_list_error.
+    struct throw_escape_errors {
+      template <class Iterator, class Token>
+      void bad_escape(escaped_list_errc code, Iterator, Iterator, Token&) {
+        if (code == escape_at_end)
+          BOOST_THROW_EXCEPTION(escaped_list_error(std::string("cannot end with escape")));
+        BOOST_THROW_EXCEPTION(escaped_list_error(std::string("unknown escape sequence")));
+      }
+    };
+  }
+
+  // A field found by escaped_list_separator without copying it: the range
+  // of the input it takes up, less the separator. If the field has no
+  // escape sequences and is either unquoted or quoted as a whole, [begin(),
+  // end()) is its value, without the quotes; otherwise needs_unescape() is
+  // true, [begin(), end()) is the raw field, and the value is obtained with
+  // escaped_list_separator::unescape_into. Requires forward iterators.
+  template <class Iterator>
+  class escaped_field {
+  public:
+    typedef Iterator iterator;
+
+    escaped_field()
+      : first_(), last_(), raw_first_(), raw_last_(), needs_unescape_(false)
+      { }
+
+    escaped_field(Iterator first, Iterator last, Iterator raw_first,
+                  Iterator raw_last, bool needs_unescape)
+      : first_(first), last_(last), raw_first_(raw_first),
+        raw_last_(raw_last), needs_unescape_(needs_unescape) { }
+
+    Iterator begin() const { return first_; }
+    Iterator end() const { return last_; }
+    Iterator raw_begin() const { return raw_first_; }
+    Iterator raw_end() const { return raw_last_; }
+    bool needs_unescape() const { return needs_unescape_; }
+    bool empty() const { return first_ == last_; }
+
+  private:
+    Iterator first_;
+    Iterator last_;
+    Iterator raw_first_;
+    Iterator raw_last_;
+    bool needs_unescape_;
+  };
+
 
 // The out of the box GCC 2.95 on cygwin does not have a char_traits class.
 // MSVC does not like the following typename
@@ -99,6 +272,10 @@ namespace boost{
   class escaped_list_separator {
 
   private:
+    friend class tokenizer_detail::separator_state<escaped_list_separator>;
+    friend class escaped_list_spec<Char,Traits>;
+    template <class C, class T, class E>
+    friend class lenient_escaped_list_separator;
     typedef std::basic_string<Char,Traits> string_type;
     struct char_eq {
       Char e_;
@@ -112,91 +289,326 @@ namespace boost{
     string_type  quote_;
     bool last_;
 
-    bool is_escape(Char e) {
+    bool is_escape(Char e) const {
       char_eq f(e);
       return std::find_if(escape_.begin(),escape_.end(),f)!=escape_.end();
     }
-    bool is_c(Char e) {
+    bool is_c(Char e) const {
       char_eq f(e);
       return std::find_if(c_.begin(),c_.end(),f)!=c_.end();
     }
-    bool is_quote(Char e) {
+    bool is_quote(Char e) const {
       char_eq f(e);
       return std::find_if(quote_.begin(),quote_.end(),f)!=quote_.end();
     }
     template <typename iterator, typename Token>
-    void do_escape(iterator& next,iterator end,Token& tok) {
-      if (++next == end)
-        BOOST_THROW_EXCEPTION(escaped_list_error(std::string("cannot end with escape")));
-      if (Traits::eq(*next,'n')) {
+    void do_escape(iterator& next,iterator end,Token& tok) const {
+      do_escape(*this,next,end,tok);
+    }
+    template <typename Classifier, typename iterator, typename Token>
+    static void do_escape(const Classifier& cls,iterator& next,iterator end,
+                          Token& tok) {
+      tokenizer_detail::throw_escape_errors errors;
+      do_escape(cls,next,end,tok,errors);
+    }
+    // Leaves next on the last character of the escape sequence, and
+    // returns false if the input ended before it did. Bad sequences go to
+    // errors.bad_escape, which may throw.
+    template <typename Classifier, typename iterator, typename Token,
+              typename Errors>
+    static bool do_escape(const Classifier& cls,iterator& next,iterator end,
+                          Token& tok,Errors& errors) {
+      iterator escape(next);
+      if (++next == end) {
+        errors.bad_escape(escape_at_end,escape,next,tok);
+        return false;
+      }
+      if (!try_unescape(cls,*next,tok)) {
+        iterator after(next);
+        errors.bad_escape(unknown_escape,escape,++after,tok);
+      }
+      return true;
+    }
+    // Appends what an escape character followed by e stands for.
+    template <typename Token>
+    void unescape(Char e,Token& tok) const {
+      unescape(*this,e,tok);
+    }
+    template <typename Classifier, typename Token>
+    static void unescape(const Classifier& cls,Char e,Token& tok) {
+      if (!try_unescape(cls,e,tok))
+        BOOST_THROW_EXCEPTION(escaped_list_error(std::string("unknown escape sequence")));
+    }
+    template <typename Classifier, typename Token>
+    static bool try_unescape(const Classifier& cls,Char e,Token& tok) {
+      if (Traits::eq(e,'n')) {
         tok+='\n';
-        return;
+        return true;
       }
-      else if (is_quote(*next)) {
-        tok+=*next;
-        return;
+      else if (cls.is_quote(e)) {
+        tok+=e;
+        return true;
       }
-      else if (is_c(*next)) {
-        tok+=*next;
-        return;
+      else if (cls.is_c(e)) {
+        tok+=e;
+        return true;
       }
-      else if (is_escape(*next)) {
-        tok+=*next;
-        return;
+      else if (cls.is_escape(e)) {
+        tok+=e;
+        return true;
       }
       else
-        BOOST_THROW_EXCEPTION(escaped_list_error(std::string("unknown escape sequence")));
+        return false;
     }
 
-    public:
-
-    explicit escaped_list_separator(Char  e = '\\',
-                                    Char c = ',',Char  q = '\"')
-      : escape_(1,e), c_(1,c), quote_(1,q), last_(false) { }
-
-    escaped_list_separator(string_type e, string_type c, string_type q)
-      : escape_(e), c_(c), quote_(q), last_(false) { }
-
-    void reset() {last_=false;}
-
-    template <typename InputIterator, typename Token>
-    bool operator()(InputIterator& next,InputIterator end,Token& tok) {
-      bool bInQuote = false;
-      tok = Token();
-
-      if (next == end) {
-        if (last_) {
-          last_ = false;
-          return true;
+    // The parsing loop of operator(), for any Classifier with is_escape,
+    // is_c and is_quote members; escaped_list_spec runs it with its table.
+    template <typename Classifier, typename InputIterator, typename Token,
+              typename Observer>
+    static bool scan(const Classifier& cls,bool& last,InputIterator& next,
+                     InputIterator end,Token& tok,Observer& obs) {
+      tokenizer_detail::throw_escape_errors errors;
+      return scan(cls,last,next,end,tok,obs,errors);
+    }
+    template <typename Classifier, typename InputIterator, typename Token,
+              typename Observer, typename Errors>
+    static bool scan(const Classifier& cls,bool& last,InputIterator& next,
+                     InputIterator end,Token& tok,Observer& obs,
+                     Errors& errors) {
+      tokenizer_detail::input_ends in;
+      return scan(cls,last,next,end,tok,obs,errors,in);
+    }
+    template <typename Classifier, typename InputIterator, typename Token,
+              typename Observer, typename Errors, typename Input>
+    static bool scan(const Classifier& cls,bool& last,InputIterator& next,
+                     InputIterator end,Token& tok,Observer& obs,
+                     Errors& errors,Input& in) {
+      typedef tokenizer_detail::token_location_traits<Token> location;
+      bool bInQuote = in.in_quote();
+
+      if (!in.in_token()) {
+        tokenizer_detail::token_clear_traits<Token>::clear(tok);
+        if (next == end) {
+          if (last && !in.more()) {
+            last = false;
+            location::set(tok,next,next);
+            return true;
+          }
+          else
+            return false;
+        }
+        last = false;
+      }
+      InputIterator start(next);
+      if (in.escape()) {
+        // The input before this one ended with an escape character.
+        if (next == end) {
+          if (in.more()) {
+            in.cut_field(bInQuote,true);
+            return false;
+          }
+          errors.bad_escape(escape_at_end,next,next,tok);
+        }
+        else {
+          if (!try_unescape(cls,*next,tok)) {
+            InputIterator after(next);
+            errors.bad_escape(unknown_escape,next,++after,tok);
+          }
+          ++next;
         }
-        else
-          return false;
       }
-      last_ = false;
       for (;next != end;++next) {
-        if (is_escape(*next)) {
-          do_escape(next,end,tok);
+        if (cls.is_escape(*next)) {
+          obs.escape();
+          if (in.more()) {
+            InputIterator after(next);
+            if (++after == end) {
+              next = after;
+              in.cut_field(bInQuote,true);
+              return false;
+            }
+          }
+          if (!do_escape(cls,next,end,tok,errors))
+            break;
         }
-        else if (is_c(*next)) {
+        else if (cls.is_c(*next)) {
           if (!bInQuote) {
             // If we are not in quote, then we are done
+            location::set(tok,start,next);
             ++next;
             // The last character was a c, that means there is
             // 1 more blank field
-            last_ = true;
+            last = true;
             return true;
           }
           else tok+=*next;
         }
-        else if (is_quote(*next)) {
+        else if (cls.is_quote(*next)) {
+          obs.quote();
           bInQuote=!bInQuote;
         }
         else {
           tok += *next;
         }
       }
+      if (in.more()) {
+        in.cut_field(bInQuote,false);
+        return false;
+      }
+      location::set(tok,start,next);
+      return true;
+    }
+
+    // The view mode of scan: finds the next field and checks its escape
+    // sequences, without building it.
+    template <typename Classifier, typename Iterator>
+    static bool scan_field(const Classifier& cls,bool& last,Iterator& next,
+                           Iterator end,escaped_field<Iterator>& field) {
+      if (next == end) {
+        if (last) {
+          last = false;
+          field = escaped_field<Iterator>(next,next,next,next,false);
+          return true;
+        }
+        else
+          return false;
+      }
+      last = false;
+      Iterator start(next);
+      Iterator close(next);
+      bool bInQuote = false;
+      bool escaped = false;
+      int quotes = 0;
+      for (;next != end;++next) {
+        if (cls.is_escape(*next)) {
+          tokenizer_detail::discard_token tok;
+          do_escape(cls,next,end,tok);
+          escaped = true;
+        }
+        else if (cls.is_c(*next)) {
+          if (!bInQuote)
+            break;
+        }
+        else if (cls.is_quote(*next)) {
+          bInQuote=!bInQuote;
+          if (++quotes == 2)
+            close = next;
+        }
+      }
+      Iterator stop(next);
+      if (next != end) {
+        ++next;
+        // The last character was a c, that means there is
+        // 1 more blank field
+        last = true;
+      }
+
+      Iterator inner(start);
+      Iterator after_close(close);
+      if (!escaped && quotes == 0)
+        field = escaped_field<Iterator>(start,stop,start,stop,false);
+      else if (!escaped && quotes == 2 && cls.is_quote(*start) &&
+               ++after_close == stop)
+        field = escaped_field<Iterator>(++inner,close,start,stop,false);
+      else
+        field = escaped_field<Iterator>(start,stop,start,stop,true);
       return true;
     }
+
+    template <typename Classifier, typename Iterator, typename Token>
+    static void unescape_into(const Classifier& cls,
+                              const escaped_field<Iterator>& field,
+                              Token& tok) {
+      if (!field.needs_unescape()) {
+        tok.assign(field.begin(),field.end());
+        return;
+      }
+      tok.assign(field.begin(),field.begin());
+      for (Iterator next = field.begin();next != field.end();++next) {
+        if (cls.is_escape(*next))
+          do_escape(cls,next,field.end(),tok);
+        else if (!cls.is_quote(*next))
+          tok+=*next;
+      }
+    }
+
+    public:
+
+    explicit escaped_list_separator(Char  e = '\\',
+                                    Char c = ',',Char  q = '\"')
+      : escape_(1,e), c_(1,c), quote_(1,q), last_(false) { }
+
+    escaped_list_separator(string_type e, string_type c, string_type q)
+      : escape_(e), c_(c), quote_(q), last_(false) { }
+
+    void reset() {last_=false;}
+
+    template <typename InputIterator, typename Token>
+    bool operator()(InputIterator& next,InputIterator end,Token& tok) {
+      tokenizer_detail::null_observer obs;
+      return (*this)(next,end,tok,obs);
+    }
+
+    // Same as above, and also tells obs about every escape sequence
+    // (obs.escape()) and every quote character (obs.quote()) it parses.
+    template <typename InputIterator, typename Token, typename Observer>
+    bool operator()(InputIterator& next,InputIterator end,Token& tok,
+                    Observer& obs) {
+      return scan(*this,last_,next,end,tok,obs);
+    }
+
+    // The parsing loop of operator(), over input that may go on past end;
+    // see has_token_push.
+    template <typename Iterator, typename Token, typename Input>
+    bool push(Iterator& next,Iterator end,Token& tok,Input& in) {
+      tokenizer_detail::null_observer obs;
+      tokenizer_detail::throw_escape_errors errors;
+      return scan(*this,last_,next,end,tok,obs,errors,in);
+    }
+
+    // View mode: finds the next field without copying it. Fields that
+    // need unescaping are flagged; see escaped_field.
+    template <typename Iterator>
+    bool operator()(Iterator& next,Iterator end,
+                    escaped_field<Iterator>& field) {
+      return scan_field(*this,last_,next,end,field);
+    }
+
+    // Stores the value of a field found in view mode in tok, reusing the
+    // storage tok already has.
+    template <typename Iterator, typename Token>
+    void unescape_into(const escaped_field<Iterator>& field,
+                       Token& tok) const {
+      unescape_into(*this,field,tok);
+    }
+
+    // Like operator(), but only finds the end of the token.
+    template <typename InputIterator>
+    bool skip(InputIterator& next, InputIterator end) {
+      tokenizer_detail::discard_token tok;
+      return (*this)(next,end,tok);
+    }
+
+    // Returns the number of tokens a freshly reset separator finds in
+    // [next, end): one more than the number of separators outside quotes.
+    // Escape sequences are checked exactly as operator() checks them.
+    template <typename InputIterator>
+    std::size_t count(InputIterator next, InputIterator end) const {
+      if (next == end)
+        return 0;
+      tokenizer_detail::discard_token tok;
+      std::size_t n = 1;
+      bool bInQuote = false;
+      for (;next != end;++next) {
+        if (is_escape(*next))
+          do_escape(next,end,tok);
+        else if (is_c(*next))
+          n += !bInQuote;
+        else if (is_quote(*next))
+          bInQuote=!bInQuote;
+      }
+      return n;
+    }
   };
 
   //===========================================================================
@@ -229,13 +641,15 @@ namespace boost{
   template<typename traits>
   struct traits_extension_details<traits, 1> : public traits {
     typedef typename traits::char_type char_type;
+    // A negative char is passed on as the byte it holds: the C functions
+    // are only defined for EOF and the values of unsigned char.
     static bool isspace(char_type c)
     {
-       return std::isspace(c) != 0;
+       return std::isspace(static_cast<unsigned char>(c)) != 0;
     }
     static bool ispunct(char_type c)
     {
-       return std::ispunct(c) != 0;
+       return std::ispunct(static_cast<unsigned char>(c)) != 0;
     }
   };
 #endif
@@ -243,6 +657,7 @@ namespace boost{
 
   // In case there is no cwctype header, we implement the checks manually.
   // We make use of the fact that the tested categories should fit in ASCII.
+  // A single byte character is checked as the unsigned char it holds.
   template<typename traits>
   struct traits_extension : public traits {
     typedef typename traits::char_type char_type;
@@ -251,7 +666,7 @@ namespace boost{
 #if !defined(BOOST_NO_CWCTYPE)
       return traits_extension_details<traits, sizeof(char_type)>::isspace(c);
 #else
-      return static_cast< unsigned >(c) <= 255 && std::isspace(c) != 0;
+      return is_byte(c) && std::isspace(static_cast<unsigned char>(c)) != 0;
 #endif
     }
 
@@ -260,9 +675,17 @@ namespace boost{
 #if !defined(BOOST_NO_CWCTYPE)
       return traits_extension_details<traits, sizeof(char_type)>::ispunct(c);
 #else
-      return static_cast< unsigned >(c) <= 255 && std::ispunct(c) != 0;
+      return is_byte(c) && std::ispunct(static_cast<unsigned char>(c)) != 0;
 #endif
     }
+
+#if defined(BOOST_NO_CWCTYPE)
+  private:
+    static bool is_byte(char_type c)
+    {
+      return sizeof(char_type) == 1 || static_cast< unsigned >(c) <= 255;
+    }
+#endif
   };
 
   // The assign_or_plus_equal struct contains functions that implement
@@ -273,30 +696,33 @@ namespace boost{
   // When an input iterator is being used, the situation is reversed.
   // The assign method does nothing, plus_equal invokes operator +=,
   // and the clearing method sets the supplied token to the default
-  // token constructor's result.
+  // token constructor's result. A std::basic_string token is cleared
+  // instead, so that it keeps its capacity: the token of a token_iterator
+  // is reused for every token, and so stops growing once it can hold the
+  // longest of them.
   //
 
   template<class IteratorTag>
   struct assign_or_plus_equal {
     template<class Iterator, class Token>
-    static void assign(Iterator b, Iterator e, Token &t) {
+    static BOOST_CXX14_CONSTEXPR void assign(Iterator b, Iterator e, Token &t) {
       t.assign(b, e);
     }
 
     template<class Token, class Value>
-    static void plus_equal(Token &, const Value &) { }
+    static BOOST_CXX14_CONSTEXPR void plus_equal(Token &, const Value &) { }
 
     // If we are doing an assign, there is no need for the
     // the clear.
     //
     template<class Token>
-    static void clear(Token &) { }
+    static BOOST_CXX14_CONSTEXPR void clear(Token &) { }
   };
 
   template <>
   struct assign_or_plus_equal<std::input_iterator_tag> {
     template<class Iterator, class Token>
-    static void assign(Iterator , Iterator , Token &) { }
+    static BOOST_CXX14_CONSTEXPR void assign(Iterator , Iterator , Token &) { }
     template<class Token, class Value>
     static void plus_equal(Token &t, const Value &v) {
       t += v;
@@ -305,9 +731,95 @@ namespace boost{
     static void clear(Token &t) {
       t = Token();
     }
+    template<class Char, class Tr, class Alloc>
+    static void clear(std::basic_string<Char,Tr,Alloc> &t) {
+      t.clear();
+    }
+  };
+
+
+  // Tells a token whether it is data or a kept delimiter. Most token
+  // types do not record it, so the generic case does nothing.
+  //
+  template<class Token>
+  struct token_kind_traits {
+    static BOOST_CXX14_CONSTEXPR void set(Token &, token_kind) { }
   };
 
 
+  // The class of every single byte character, as some Classifier's
+  // classify member gives it, looked up instead of computed. The table is
+  // only built once a separator has found enough tokens for it to pay for
+  // its 256 calls to classify, so that separators built for a short input
+  // do not pay for it, and it lives on the heap, so that it does not make
+  // every copy of a separator larger. Copies start without a table of
+  // their own. Entry i is the class of the char that holds byte i, which
+  // traits_extension hands to isspace() and ispunct() as that byte even
+  // where char is signed. Wider characters have no table, and lookup
+  // fails for them.
+  //
+  template<class Char, bool Bytes = (sizeof(Char) == 1)>
+  class char_class_table {
+  public:
+    template<class Classifier>
+    void found_token(const Classifier &) { }
+    template<class Classifier>
+    void build(const Classifier &) { }
+    bool built() const { return false; }
+    bool lookup(Char, unsigned char &) const { return false; }
+  };
+
+  template<class Char>
+  class char_class_table<Char, true> {
+  public:
+    // The number of tokens after which found_token builds the table.
+    BOOST_STATIC_CONSTANT(unsigned, tokens_before_table = 64);
+
+    char_class_table() : entries_(0), tokens_(0) { }
+    char_class_table(const char_class_table &) : entries_(0), tokens_(0) { }
+    char_class_table& operator=(const char_class_table &) {
+      delete[] entries_;
+      entries_ = 0;
+      tokens_ = 0;
+      return *this;
+    }
+    ~char_class_table() { delete[] entries_; }
+
+    template<class Classifier>
+    void found_token(const Classifier &cls) {
+      if (!entries_ && ++tokens_ == tokens_before_table)
+        build(cls);
+    }
+
+    template<class Classifier>
+    void build(const Classifier &cls) {
+      if (!entries_)
+        entries_ = new unsigned char[256];
+      for (unsigned i = 0; i < 256; ++i)
+        entries_[i] = cls.classify(
+          static_cast<Char>(static_cast<unsigned char>(i)));
+    }
+
+    bool built() const { return entries_ != 0; }
+
+    bool lookup(Char c, unsigned char &e) const {
+      if (!entries_)
+        return false;
+      e = entries_[static_cast<unsigned char>(c)];
+      return true;
+    }
+
+  private:
+    unsigned char *entries_;
+    unsigned tokens_;
+  };
+
+  // The bits of the delimiter mask of a character, as the classifiers of
+  // char_separator's parsing loop give it. A character can be both.
+  //
+  enum delimiter_class { dropped_delimiter = 1, kept_delimiter = 2 };
+
+
   template<class Iterator>
   struct pointer_iterator_category{
     typedef std::random_access_iterator_tag type;
@@ -332,6 +844,82 @@ namespace boost{
     typedef typename cat::type iterator_category;
   };
 
+  // Counts the tokens in a sequence of character classes, where class 0 is
+  // a dropped delimiter, 1 is part of a token and 2 is a kept delimiter.
+  // With empty tokens kept, every delimiter ends a token and every kept
+  // delimiter is a token too; otherwise a token is a kept delimiter or the
+  // start of a run of token characters. Both loops are free of branches
+  // other than the loop test.
+  template <class InputIterator, class Classifier>
+  std::size_t count_classified(InputIterator next, InputIterator end,
+                               const Classifier& cls, bool keep_empty)
+  {
+    std::size_t n = 0;
+    if (keep_empty) {
+      n = 1;
+      for (; next != end; ++next) {
+        unsigned k = cls(*next);
+        n += (k != 1) + (k == 2);
+      }
+    }
+    else {
+      unsigned prev = 0;
+      for (; next != end; ++next) {
+        unsigned k = cls(*next);
+        unsigned data = k & 1;
+        n += (k >> 1) + (data & (prev ^ 1));
+        prev = data;
+      }
+    }
+    return n;
+  }
+
+  // Whether a sequence is long enough to be worth building a table for.
+  template <class Iterator>
+  bool worth_a_table(Iterator first, Iterator last,
+                     std::random_access_iterator_tag) {
+    return last - first >= 256;
+  }
+
+  template <class Iterator>
+  bool worth_a_table(Iterator, Iterator, std::input_iterator_tag) {
+    return false;
+  }
+
+  // The separator_state class saves the part of a TokenizerFunction that
+  // changes from one token to the next, so that scanning can be resumed at
+  // a token boundary later on. The generic version keeps a copy of the
+  // whole function object; the models in this file specialize it to keep
+  // just their few bytes of mutable state.
+  //
+  // resumes_at_token(f) tells whether f, started in some state before a
+  // token, finds the same token when started in that state at the first
+  // character of the token instead. That holds for the models that only
+  // pass over dropped delimiters on the way to a token, and lets
+  // tokenize_buffered forget the delimiters it has passed over.
+  template <class TokenizerFunc>
+  class separator_state {
+    TokenizerFunc f_;
+  public:
+    explicit separator_state(const TokenizerFunc& f) : f_(f) { }
+    void restore(TokenizerFunc& f) const { f = f_; }
+    static bool resumes_at_token(const TokenizerFunc&) { return false; }
+  };
+
+  template <class Char, class Traits>
+  class separator_state<escaped_list_separator<Char,Traits> > {
+    bool last_;
+  public:
+    explicit separator_state(const escaped_list_separator<Char,Traits>& f)
+      : last_(f.last_) { }
+    void restore(escaped_list_separator<Char,Traits>& f) const {
+      f.last_ = last_;
+    }
+    static bool resumes_at_token(const escaped_list_separator<Char,Traits>&) {
+      return false;
+    }
+  };
+
 
   } // namespace tokenizer_detail
 
@@ -342,6 +930,8 @@ namespace boost{
 
   class offset_separator {
   private:
+    friend class tokenizer_detail::separator_state<offset_separator>;
+    template <std::size_t N> friend class constexpr_offset_separator;
 
     std::vector<int> offsets_;
     unsigned int current_offset_;
@@ -366,6 +956,51 @@ namespace boost{
 
     template <typename InputIterator, typename Token>
     bool operator()(InputIterator& next, InputIterator end, Token& tok)
+    {
+      tokenizer_detail::input_ends in;
+      return push(next, end, tok, in);
+    }
+
+    // The parsing loop of operator(), over input that may go on past end;
+    // see has_token_push.
+    template <typename Iterator, typename Token, typename Input>
+    bool push(Iterator& next, Iterator end, Token& tok, Input& in)
+    {
+      BOOST_ASSERT(!offsets_.empty());
+      return scan(&offsets_[0], offsets_.size(), wrap_offsets_,
+                  return_partial_last_, current_offset_, next, end, tok, in);
+    }
+
+    // Like operator(), but only finds the end of the token.
+    template <typename InputIterator>
+    bool skip(InputIterator& next, InputIterator end) {
+      tokenizer_detail::discard_token tok;
+      return (*this)(next,end,tok);
+    }
+
+  private:
+    // The parsing loop of operator(), over the n offsets at offsets;
+    // constexpr_offset_separator runs it on its own array.
+    template <typename InputIterator, typename Token>
+    static BOOST_CXX14_CONSTEXPR bool scan(const int* offsets, std::size_t n,
+                                           bool wrap_offsets,
+                                           bool return_partial_last,
+                                           unsigned int& current_offset,
+                                           InputIterator& next,
+                                           InputIterator end, Token& tok)
+    {
+      tokenizer_detail::input_ends in = tokenizer_detail::input_ends();
+      return scan(offsets, n, wrap_offsets, return_partial_last,
+                  current_offset, next, end, tok, in);
+    }
+    template <typename InputIterator, typename Token, typename Input>
+    static BOOST_CXX14_CONSTEXPR bool scan(const int* offsets, std::size_t n,
+                                           bool wrap_offsets,
+                                           bool return_partial_last,
+                                           unsigned int& current_offset,
+                                           InputIterator& next,
+                                           InputIterator end, Token& tok,
+                                           Input& in)
     {
       typedef tokenizer_detail::assign_or_plus_equal<
         BOOST_DEDUCED_TYPENAME tokenizer_detail::get_iterator_category<
@@ -373,39 +1008,58 @@ namespace boost{
         >::iterator_category
       > assigner;
 
-      BOOST_ASSERT(!offsets_.empty());
-
-      assigner::clear(tok);
       InputIterator start(next);
 
-      if (next == end)
-        return false;
+      if (!in.in_token()) {
+        assigner::clear(tok);
 
-      if (current_offset_ == offsets_.size())
-      {
-        if (wrap_offsets_)
-          current_offset_=0;
-        else
+        if (next == end)
           return false;
+
+        if (current_offset == n)
+        {
+          if (wrap_offsets)
+            current_offset=0;
+          else
+            return false;
+        }
       }
 
-      int c = offsets_[current_offset_];
-      int i = 0;
+      int c = offsets[current_offset];
+      int i = static_cast<int>(in.taken());
       for (; i < c; ++i) {
         if (next == end)break;
         assigner::plus_equal(tok,*next++);
       }
       assigner::assign(start,next,tok);
+      if (i < c && in.more()) {
+        in.cut_offset(static_cast<unsigned>(i));
+        return false;
+      }
 
-      if (!return_partial_last_)
+      if (!return_partial_last)
         if (i < (c-1) )
           return false;
 
-      ++current_offset_;
+      ++current_offset;
       return true;
     }
   };
 
+  namespace tokenizer_detail {
+  template <>
+  class separator_state<offset_separator> {
+    unsigned int current_offset_;
+  public:
+    explicit separator_state(const offset_separator& f)
+      : current_offset_(f.current_offset_) { }
+    void restore(offset_separator& f) const {
+      f.current_offset_ = current_offset_;
+    }
+    static bool resumes_at_token(const offset_separator&) { return false; }
+  };
+  } // namespace tokenizer_detail
+
 
   //===========================================================================
   // The char_separator class breaks a sequence of characters into
@@ -428,6 +1082,10 @@ namespace boost{
     typename Tr = BOOST_DEDUCED_TYPENAME std::basic_string<Char>::traits_type >
   class char_separator
   {
+    friend class tokenizer_detail::separator_state<char_separator>;
+    friend class char_separator_spec<Char,Tr>;
+    friend class constexpr_char_separator<Char,Tr>;
+    friend class tokenizer_detail::char_class_table<Char>;
     typedef tokenizer_detail::traits_extension<Tr> Traits;
     typedef std::basic_string<Char,Tr> string_type;
   public:
@@ -454,101 +1112,304 @@ namespace boost{
         m_empty_tokens(drop_empty_tokens),
         m_output_done(false) { }
 
-    void reset() { }
+    void reset() { m_output_done = false; }
 
     template <typename InputIterator, typename Token>
     bool operator()(InputIterator& next, InputIterator end, Token& tok)
+    {
+      m_classes.found_token(*this);
+      if (m_classes.built())
+        return scan(*this, m_empty_tokens, m_output_done, next, end, tok);
+      return scan(list_classifier(*this), m_empty_tokens, m_output_done,
+                  next, end, tok);
+    }
+
+    // The parsing loop of operator(), over input that may go on past end;
+    // see has_token_push.
+    template <typename Iterator, typename Token, typename Input>
+    bool push(Iterator& next, Iterator end, Token& tok, Input& in)
+    {
+      if (!in.in_token())
+        m_classes.found_token(*this);
+      if (m_classes.built())
+        return scan(*this, m_empty_tokens, m_output_done, next, end, tok, in);
+      return scan(list_classifier(*this), m_empty_tokens, m_output_done,
+                  next, end, tok, in);
+    }
+
+    // Like operator(), but only finds the end of the token.
+    template <typename InputIterator>
+    bool skip(InputIterator& next, InputIterator end) {
+      tokenizer_detail::discard_token tok;
+      return (*this)(next,end,tok);
+    }
+
+    // Returns the number of tokens a freshly constructed separator finds in
+    // [next, end), by classifying each character once. Narrow characters
+    // are looked up in the separator's table if it has built one, and
+    // otherwise, for long sequences, in a table built for the call, so
+    // that the delimiter lists are searched only 256 times.
+    template <typename InputIterator>
+    std::size_t count(InputIterator next, InputIterator end) const
+    {
+      typedef BOOST_DEDUCED_TYPENAME tokenizer_detail::get_iterator_category<
+        InputIterator
+      >::iterator_category category;
+
+      if (next == end)
+        return 0;
+      bool keep_empty = m_empty_tokens == keep_empty_tokens;
+      if (!m_classes.built() && sizeof(Char) == 1 &&
+          tokenizer_detail::worth_a_table(next, end, category())) {
+        tokenizer_detail::char_class_table<Char> table;
+        table.build(*this);
+        return tokenizer_detail::count_classified(
+          next, end, classifier(*this, table), keep_empty);
+      }
+      return tokenizer_detail::count_classified(
+        next, end, classifier(*this, m_classes), keep_empty);
+    }
+
+  private:
+    // What the parsing loop does at the first character of a token.
+    enum scan_action {
+      scan_run,         // take the token characters from here
+      scan_skip_run,    // pass the dropped delimiter, then as scan_run
+      scan_empty,       // return an empty token, without moving
+      scan_kept         // return this kept delimiter as a token
+    };
+
+    // The transitions of the parsing loop, two bits per entry, indexed by
+    // the mode, the state and the delimiter mask of the character. In
+    // drop_empty_tokens mode dropped delimiters have already been passed,
+    // and the state is not used.
+    static BOOST_CXX14_CONSTEXPR unsigned next_action(bool keep_empty,
+                                                      bool output_done,
+                                                      unsigned mask)
+    {
+      const unsigned table =
+        unsigned(scan_kept) << 4 | unsigned(scan_kept) << 12 |
+        unsigned(scan_empty) << 18 | unsigned(scan_empty) << 20 |
+        unsigned(scan_empty) << 22 |
+        unsigned(scan_skip_run) << 26 | unsigned(scan_kept) << 28 |
+        unsigned(scan_kept) << 30;
+      return (table >> (2 * ((keep_empty ? 8 : 0) | (output_done ? 4 : 0) |
+                             mask))) & 3;
+    }
+
+    // The parsing loop of operator(), for any Classifier whose
+    // delimiter_mask member gives the delimiter_class bits of a character,
+    // and whose is_dropped and is_delimiter members test for a dropped
+    // delimiter and for any delimiter; char_separator_spec runs it with
+    // its tables. Only the first character of a token is given its full
+    // mask, which picks one of the four actions from the table above, so
+    // that the branches on the mode and the state are not taken per token;
+    // the loops over the other characters ask only the question they need
+    // answered, so that a separator without a table searches one list for
+    // a dropped delimiter and stops at the first list that holds the
+    // character.
+    template <typename Classifier, typename InputIterator, typename Token>
+    static BOOST_CXX14_CONSTEXPR bool scan(const Classifier& cls,
+                                           empty_token_policy empty_tokens,
+                                           bool& output_done,
+                                           InputIterator& next,
+                                           InputIterator end, Token& tok)
+    {
+      tokenizer_detail::input_ends in = tokenizer_detail::input_ends();
+      return scan(cls, empty_tokens, output_done, next, end, tok, in);
+    }
+    template <typename Classifier, typename InputIterator, typename Token,
+              typename Input>
+    static BOOST_CXX14_CONSTEXPR bool scan(const Classifier& cls,
+                                           empty_token_policy empty_tokens,
+                                           bool& output_done,
+                                           InputIterator& next,
+                                           InputIterator end, Token& tok,
+                                           Input& in)
     {
       typedef tokenizer_detail::assign_or_plus_equal<
         BOOST_DEDUCED_TYPENAME tokenizer_detail::get_iterator_category<
           InputIterator
         >::iterator_category
       > assigner;
+      typedef tokenizer_detail::token_kind_traits<Token> kind;
 
-      assigner::clear(tok);
-
-      // skip past all dropped_delims
-      if (m_empty_tokens == drop_empty_tokens)
-        for (; next != end  && is_dropped(*next); ++next)
-          { }
-
+      const bool keep_empty = empty_tokens == keep_empty_tokens;
       InputIterator start(next);
+      unsigned action = scan_run;
 
-      if (m_empty_tokens == drop_empty_tokens) {
+      if (!in.in_token()) {
+        assigner::clear(tok);
+        kind::set(tok, data_token);
 
-        if (next == end)
-          return false;
+        // skip past all dropped_delims
+        if (!keep_empty)
+          for (; next != end && cls.is_dropped(*next); ++next) { }
 
-
-        // if we are on a kept_delims move past it and stop
-        if (is_kept(*next)) {
-          assigner::plus_equal(tok,*next);
-          ++next;
-        } else
-          // append all the non delim characters
-          for (; next != end && !is_dropped(*next) && !is_kept(*next); ++next)
-            assigner::plus_equal(tok,*next);
-      }
-      else { // m_empty_tokens == keep_empty_tokens
+        start = next;
 
         // Handle empty token at the end
-        if (next == end)
-        {
-          if (m_output_done == false)
-          {
-            m_output_done = true;
-            assigner::assign(start,next,tok);
-            return true;
-          }
-          else
+        if (next == end) {
+          if (!keep_empty || output_done || in.more())
             return false;
+          output_done = true;
+          assigner::assign(start,next,tok);
+          return true;
         }
 
-        if (is_kept(*next)) {
-          if (m_output_done == false)
-            m_output_done = true;
-          else {
-            assigner::plus_equal(tok,*next);
-            ++next;
-            m_output_done = false;
-          }
-        }
-        else if (m_output_done == false && is_dropped(*next)) {
-          m_output_done = true;
+        // a dropped delimiter has already been passed unless empty tokens
+        // are kept, so only the kept list need be searched
+        action = next_action(keep_empty, output_done,
+          keep_empty ? cls.delimiter_mask(*next) :
+          cls.is_kept(*next) ? unsigned(tokenizer_detail::kept_delimiter)
+                             : 0u);
+        if (action == scan_kept) {
+          assigner::plus_equal(tok,*next);
+          kind::set(tok, delimiter_token);
+          ++next;
         }
-        else {
-          if (is_dropped(*next))
-            start=++next;
-          for (; next != end && !is_dropped(*next) && !is_kept(*next); ++next)
-            assigner::plus_equal(tok,*next);
-          m_output_done = true;
+        else if (action == scan_skip_run)
+          start = ++next;
+      }
+
+      if (action == scan_run || action == scan_skip_run) {
+        // append all the non delim characters
+        for (; next != end && !cls.is_delimiter(*next); ++next)
+          assigner::plus_equal(tok,*next);
+        if (next == end && in.more()) {
+          assigner::assign(start,next,tok);
+          in.cut_token();
+          return false;
         }
       }
+      output_done = action != scan_kept;
       assigner::assign(start,next,tok);
       return true;
     }
 
-  private:
+    // The class of a character for count(), as operator() sees it in the
+    // current mode: 0 dropped delimiter, 1 token character, 2 kept
+    // delimiter. It is looked up by the delimiter mask of the character,
+    // which comes from table if that has one.
+    class classifier {
+    public:
+      classifier(const char_separator& sep,
+                 const tokenizer_detail::char_class_table<Char>& table)
+        : sep_(sep), table_(table)
+      {
+        const bool drop = sep.m_empty_tokens == drop_empty_tokens;
+        for (unsigned mask = 0; mask < 4; ++mask) {
+          const bool dropped =
+            (mask & tokenizer_detail::dropped_delimiter) != 0;
+          const bool kept = (mask & tokenizer_detail::kept_delimiter) != 0;
+          classes_[mask] = static_cast<unsigned char>(
+            (drop ? dropped : dropped && !kept) ? 0 : kept ? 2 : 1);
+        }
+      }
+
+      unsigned operator()(Char E) const {
+        unsigned char mask = 0;
+        if (!table_.lookup(E, mask))
+          mask = sep_.classify(E);
+        return classes_[mask];
+      }
+
+    private:
+      const char_separator& sep_;
+      const tokenizer_detail::char_class_table<Char>& table_;
+      unsigned char classes_[4];
+    };
+
+    // The classes of characters as the delimiter lists give them, searched
+    // for each character, for the parsing loop before m_classes is built,
+    // so that a separator that only finds a few tokens pays for no more
+    // than the searches.
+    class list_classifier {
+    public:
+      explicit list_classifier(const char_separator& sep) : sep_(sep) { }
+      bool is_dropped(Char E) const { return sep_.find_dropped(E); }
+      bool is_kept(Char E) const { return sep_.find_kept(E); }
+      bool is_delimiter(Char E) const {
+        return sep_.find_dropped(E) || sep_.find_kept(E);
+      }
+      unsigned delimiter_mask(Char E) const { return sep_.classify(E); }
+    private:
+      const char_separator& sep_;
+    };
+
     string_type m_kept_delims;
     string_type m_dropped_delims;
     bool m_use_ispunct;
     bool m_use_isspace;
     empty_token_policy m_empty_tokens;
     bool m_output_done;
+    tokenizer_detail::char_class_table<Char> m_classes;
+
+    // The delimiter_class bits of E. Once m_classes is built, single byte
+    // characters are looked up in it; when isspace() and ispunct() are
+    // used, that is with the C locale that was in effect when it was
+    // built.
+    unsigned delimiter_mask(Char E) const
+    {
+      unsigned char e = 0;
+      if (m_classes.lookup(E, e))
+        return e;
+      return classify(E);
+    }
+    unsigned char classify(Char E) const
+    {
+      return static_cast<unsigned char>(
+        (find_dropped(E) ? unsigned(tokenizer_detail::dropped_delimiter)
+                         : 0u) |
+        (find_kept(E) ? unsigned(tokenizer_detail::kept_delimiter) : 0u));
+    }
 
     bool is_kept(Char E) const
+    {
+      unsigned char e = 0;
+      if (m_classes.lookup(E, e))
+        return (e & tokenizer_detail::kept_delimiter) != 0;
+      return find_kept(E);
+    }
+    bool is_dropped(Char E) const
+    {
+      unsigned char e = 0;
+      if (m_classes.lookup(E, e))
+        return (e & tokenizer_detail::dropped_delimiter) != 0;
+      return find_dropped(E);
+    }
+    bool is_delimiter(Char E) const
+    {
+      unsigned char e = 0;
+      if (m_classes.lookup(E, e))
+        return e != 0;
+      return find_dropped(E) || find_kept(E);
+    }
+
+    // Whether the delimiter list s holds E. The lists are a few characters
+    // long, and searched for every character until m_classes is built, so
+    // they are walked in place rather than through a call to find().
+    static bool find_in(const string_type& s, Char E)
+    {
+      const Char* p = s.data();
+      for (const Char* e = p + s.size(); p != e; ++p)
+        if (Tr::eq(*p, E))
+          return true;
+      return false;
+    }
+    bool find_kept(Char E) const
     {
       if (m_kept_delims.length())
-        return m_kept_delims.find(E) != string_type::npos;
+        return find_in(m_kept_delims, E);
       else if (m_use_ispunct) {
         return Traits::ispunct(E) != 0;
       } else
         return false;
     }
-    bool is_dropped(Char E) const
+    bool find_dropped(Char E) const
     {
       if (m_dropped_delims.length())
-        return m_dropped_delims.find(E) != string_type::npos;
+        return find_in(m_dropped_delims, E);
       else if (m_use_isspace) {
         return Traits::isspace(E) != 0;
       } else
@@ -556,6 +1417,22 @@ namespace boost{
     }
   };
 
+  namespace tokenizer_detail {
+  template <class Char, class Tr>
+  class separator_state<char_separator<Char,Tr> > {
+    bool output_done_;
+  public:
+    explicit separator_state(const char_separator<Char,Tr>& f)
+      : output_done_(f.m_output_done) { }
+    void restore(char_separator<Char,Tr>& f) const {
+      f.m_output_done = output_done_;
+    }
+    static bool resumes_at_token(const char_separator<Char,Tr>& f) {
+      return f.m_empty_tokens == drop_empty_tokens;
+    }
+  };
+  } // namespace tokenizer_detail
+
   //===========================================================================
   // The following class is DEPRECATED, use class char_separators instead.
   //
@@ -571,16 +1448,44 @@ namespace boost{
     class Tr = BOOST_DEDUCED_TYPENAME std::basic_string<Char>::traits_type >
   class char_delimiters_separator {
   private:
+    friend class tokenizer_detail::char_class_table<Char>;
 
     typedef tokenizer_detail::traits_extension<Tr> Traits;
     typedef std::basic_string<Char,Tr> string_type;
+    enum { ret_class = 1, nonret_class = 2 };
     string_type returnable_;
     string_type nonreturnable_;
     bool return_delims_;
     bool no_ispunct_;
     bool no_isspace_;
+    tokenizer_detail::char_class_table<Char> classes_;
 
+    // Once operator() has found enough tokens, single byte characters are
+    // classified by a table that it fills in with find_ret and
+    // find_nonret, so with the C locale in effect then; others are
+    // classified each time.
     bool is_ret(Char E)const
+    {
+      unsigned char c;
+      if (classes_.lookup(E, c))
+        return (c & ret_class) != 0;
+      return find_ret(E);
+    }
+    bool is_nonret(Char E)const
+    {
+      unsigned char c;
+      if (classes_.lookup(E, c))
+        return (c & nonret_class) != 0;
+      return find_nonret(E);
+    }
+
+    unsigned char classify(Char E)const
+    {
+      return static_cast<unsigned char>((find_ret(E) ? ret_class : 0) |
+                                        (find_nonret(E) ? nonret_class : 0));
+    }
+
+    bool find_ret(Char E)const
     {
       if (returnable_.length())
         return  returnable_.find(E) != string_type::npos;
@@ -592,7 +1497,7 @@ namespace boost{
         }
       }
     }
-    bool is_nonret(Char E)const
+    bool find_nonret(Char E)const
     {
       if (nonreturnable_.length())
         return  nonreturnable_.find(E) != string_type::npos;
@@ -618,35 +1523,126 @@ namespace boost{
 
   public:
 
-     template <typename InputIterator, typename Token>
-     bool operator()(InputIterator& next, InputIterator end,Token& tok) {
-     tok = Token();
-
-     // skip past all nonreturnable delims
-     // skip past the returnable only if we are not returning delims
-     for (;next!=end && ( is_nonret(*next) || (is_ret(*next)
-       && !return_delims_ ) );++next) { }
-
-     if (next == end) {
-       return false;
-     }
-
-     // if we are to return delims and we are one a returnable one
-     // move past it and stop
-     if (is_ret(*next) && return_delims_) {
-       tok+=*next;
-       ++next;
-     }
-     else
-       // append all the non delim characters
-       for (;next!=end && !is_nonret(*next) && !is_ret(*next);++next)
-         tok+=*next;
-
-
-     return true;
-   }
+    template <typename InputIterator, typename Token>
+    bool operator()(InputIterator& next, InputIterator end,Token& tok) {
+      tokenizer_detail::input_ends in;
+      return push(next,end,tok,in);
+    }
+
+    // The parsing loop of operator(), over input that may go on past end;
+    // see has_token_push.
+    template <typename InputIterator, typename Token, typename Input>
+    bool push(InputIterator& next, InputIterator end, Token& tok, Input& in) {
+      InputIterator start(next);
+
+      if (!in.in_token()) {
+        classes_.found_token(*this);
+        tokenizer_detail::token_clear_traits<Token>::clear(tok);
+
+        // skip past all nonreturnable delims
+        // skip past the returnable only if we are not returning delims
+        for (;next!=end && ( is_nonret(*next) || (is_ret(*next)
+          && !return_delims_ ) );++next) { }
+
+        if (next == end) {
+          return false;
+        }
+
+        start = next;
+
+        // if we are to return delims and we are one a returnable one
+        // move past it and stop
+        if (is_ret(*next) && return_delims_) {
+          tok+=*next;
+          ++next;
+          tokenizer_detail::token_location_traits<Token>::set(tok,start,next);
+          return true;
+        }
+      }
+
+      // append all the non delim characters
+      for (;next!=end && !is_nonret(*next) && !is_ret(*next);++next)
+        tok+=*next;
+
+      if (next == end && in.more()) {
+        in.cut_token();
+        return false;
+      }
+
+      tokenizer_detail::token_location_traits<Token>::set(tok,start,next);
+
+      return true;
+    }
+
+    // Like operator(), but only finds the end of the token.
+    template <typename InputIterator>
+    bool skip(InputIterator& next, InputIterator end) {
+      tokenizer_detail::discard_token tok;
+      return (*this)(next,end,tok);
+    }
   };
 
+  template <class Char, class Traits>
+  struct has_token_skip<escaped_list_separator<Char,Traits> >
+    : public true_type { };
+
+  template <>
+  struct has_token_skip<offset_separator> : public true_type { };
+
+  template <class Char, class Tr>
+  struct has_token_skip<char_separator<Char,Tr> > : public true_type { };
+
+  template <class Char, class Tr>
+  struct has_token_skip<char_delimiters_separator<Char,Tr> >
+    : public true_type { };
+
+  template <class Char, class Traits>
+  struct has_token_push<escaped_list_separator<Char,Traits> >
+    : public true_type { };
+
+  template <>
+  struct has_token_push<offset_separator> : public true_type { };
+
+  template <class Char, class Tr>
+  struct has_token_push<char_separator<Char,Tr> > : public true_type { };
+
+  template <class Char, class Tr>
+  struct has_token_push<char_delimiters_separator<Char,Tr> >
+    : public true_type { };
+
+  namespace tokenizer_detail {
+  // Calls skip when the TokenizerFunction has it, and otherwise produces
+  // the token into a scratch object.
+  template <bool HasSkip>
+  struct token_skipper {
+    template <class TokenizerFunc, class Iterator, class Token>
+    static bool skip(TokenizerFunc& f, Iterator& next, Iterator end,
+                     Token& scratch) {
+      return f(next,end,scratch);
+    }
+  };
+
+  template <>
+  struct token_skipper<true> {
+    template <class TokenizerFunc, class Iterator, class Token>
+    static bool skip(TokenizerFunc& f, Iterator& next, Iterator end,
+                     Token&) {
+      return f.skip(next,end);
+    }
+  };
+
+  // char_delimiters_separator has no state at all.
+  template <class Char, class Tr>
+  class separator_state<char_delimiters_separator<Char,Tr> > {
+  public:
+    explicit separator_state(const char_delimiters_separator<Char,Tr>&) { }
+    void restore(char_delimiters_separator<Char,Tr>&) const { }
+    static bool resumes_at_token(const char_delimiters_separator<Char,Tr>&) {
+      return true;
+    }
+  };
+  } // namespace tokenizer_detail
+
 
 } //namespace boost
 
@@ -22,6 +22,7 @@
 #include <boost/iterator/iterator_adaptor.hpp>
 #include <boost/iterator/minimum_category.hpp>
 #include <boost/token_functions.hpp>
+#include <cstddef>
 #include <utility>
 
 namespace boost
@@ -99,6 +100,20 @@ namespace boost
 
       bool at_end()const{return !valid_;}
 
+      // Moves n tokens forward, like n increments. Tokens that are passed
+      // over are not built when the TokenizerFunction supports skipping
+      // (see has_token_skip); only the token landed on is.
+      void skip(std::size_t n){
+          if(n == 0) return;
+          BOOST_ASSERT(valid_);
+          typedef tokenizer_detail::token_skipper<
+              has_token_skip<TokenizerFunc>::value> skipper;
+          for(; n > 1 && valid_; --n)
+              valid_ = skipper::skip(f_,begin_,end_,tok_);
+          if(valid_)
+              valid_ = f_(begin_,end_,tok_);
+      }
+
 
 
 
@@ -126,6 +141,13 @@ namespace boost
         return ret_type(fun,begin,end);
     }
 
+    // Same as it.skip(n).
+    template <class TokenizerFunc, class Iterator, class Type>
+    void advance_tokens(token_iterator<TokenizerFunc,Iterator,Type>& it,
+                        std::size_t n){
+        it.skip(n);
+    }
+
 } // namespace boost
 
 #endif
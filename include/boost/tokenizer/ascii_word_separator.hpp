@@ -0,0 +1,306 @@
+// Boost tokenizer/ascii_word_separator.hpp  --------------------------------//
+
+// Copyright 2026 Boost.Tokenizer contributors.
+
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// See http://www.boost.org/libs/tokenizer for documentation.
+
+#ifndef BOOST_TOKENIZER_ASCII_WORD_SEPARATOR_HPP_
+#define BOOST_TOKENIZER_ASCII_WORD_SEPARATOR_HPP_
+
+#include <cstddef>
+#include <cstring>
+#include <iterator>
+#include <boost/config.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/token_functions.hpp>
+#include <boost/tokenizer/detail/contiguous_iterator.hpp>
+#include <boost/type_traits/integral_constant.hpp>
+#include <boost/type_traits/is_same.hpp>
+#include <boost/type_traits/remove_cv.hpp>
+
+namespace boost {
+
+  enum punctuation_policy { drop_punctuation, keep_punctuation };
+
+  namespace tokenizer_detail {
+
+  // Tests on eight chars at once, loaded into a 64 bit integer. Each test
+  // sets the high bit of the bytes it is true for; the byte order of the
+  // load does not matter, since only whether any or all bytes match is
+  // used.
+  struct swar {
+    typedef boost::uint64_t word;
+
+    static word ones() { return ~word(0) / 255; }
+    static word high() { return ones() << 7; }
+
+    static word load(const char* p) {
+      word w;
+      std::memcpy(&w, p, sizeof(w));
+      return w;
+    }
+
+    // The bytes of x with a value in [lo, hi], for hi < 0x80. The high bit
+    // is cleared before adding, so that no carry crosses into the next
+    // byte.
+    static word in_range(word x, unsigned lo, unsigned hi) {
+      word y = x & ~high();
+      word at_least_lo = y + ones() * (0x80 - lo);
+      word above_hi = y + ones() * (0x7F - hi);
+      return at_least_lo & ~above_hi & ~x & high();
+    }
+
+    static word ascii_space(word x) {
+      return in_range(x, 0x09, 0x0D) | in_range(x, 0x20, 0x20);
+    }
+
+    static word ascii_punct(word x) {
+      return in_range(x, 0x21, 0x2F) | in_range(x, 0x3A, 0x40) |
+             in_range(x, 0x5B, 0x60) | in_range(x, 0x7B, 0x7E);
+    }
+
+    // All bytes that could end a word. This includes the other control
+    // characters, which are part of words, so a block that has any is
+    // checked a char at a time.
+    static word maybe_delimiter(word x) {
+      return in_range(x, 0x00, 0x2F) | in_range(x, 0x3A, 0x40) |
+             in_range(x, 0x5B, 0x60) | in_range(x, 0x7B, 0x7F);
+    }
+  };
+
+  // The class of every char, by its unsigned value: 1 for the ASCII
+  // whitespace, 2 for the ASCII punctuation, and 0 for the chars of
+  // words, which include all of those of 0x80 and above. A class template
+  // static, so that it can live in a header and be shared by all
+  // separators.
+  template <class Dummy>
+  struct ascii_classes {
+    static const unsigned char table[256];
+  };
+
+  template <class Dummy>
+  const unsigned char ascii_classes<Dummy>::table[256] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 2, 2,
+    2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 2,
+    2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 0
+    // and 0 for the 128 chars of 0x80 and above
+  };
+
+  } // namespace tokenizer_detail
+
+
+  //===========================================================================
+  // The ascii_word_separator class is a model of TokenizerFunction that
+  // splits char text into words. The ASCII whitespace characters are
+  // dropped delimiters, and the ASCII punctuation characters are kept
+  // delimiters, or dropped ones with drop_punctuation. Empty tokens are never
+  // returned. All other chars, including those of 0x80 and above, are part
+  // of words, so UTF-8 text is split at ASCII delimiters only. For ASCII this
+  // is what char_separator<char>() does in the "C" locale, but the classes
+  // are fixed and do not depend on the locale.
+  //
+  // Chars are classified by one lookup in a table of 256 entries, shared
+  // by all separators. For pointers to char and the iterators of
+  // std::string and std::vector<char>, a run of delimiters or of word chars
+  // that goes on past long_run chars is passed over eight chars at a time
+  // with integer operations; words and gaps are mostly shorter than that,
+  // and for them the lookups are cheaper than the block tests. Return the
+  // tokens as token_view to avoid copying them.
+
+  class ascii_word_separator {
+  public:
+    explicit ascii_word_separator(punctuation_policy punct = keep_punctuation)
+      : m_dropped(static_cast<unsigned char>(
+          punct == keep_punctuation ? space_class
+                                    : space_class | punct_class)),
+        m_kept(static_cast<unsigned char>(
+          punct == keep_punctuation ? punct_class : 0)),
+        m_keep_punct(punct == keep_punctuation)
+    { }
+
+    void reset() { }
+
+    template <typename InputIterator, typename Token>
+    bool operator()(InputIterator& next, InputIterator end, Token& tok)
+    {
+      typedef BOOST_DEDUCED_TYPENAME tokenizer_detail::get_iterator_category<
+        InputIterator
+      >::iterator_category category;
+      typedef BOOST_DEDUCED_TYPENAME remove_cv<BOOST_DEDUCED_TYPENAME
+        std::iterator_traits<InputIterator>::value_type>::type value_type;
+      typedef integral_constant<bool,
+        tokenizer_detail::is_contiguous_iterator<InputIterator, char>::value &&
+        is_same<value_type, char>::value> contiguous;
+
+      return scan(next, end, tok, category(), contiguous());
+    }
+
+    // Like operator(), but only finds the end of the token.
+    template <typename InputIterator>
+    bool skip(InputIterator& next, InputIterator end) {
+      tokenizer_detail::discard_token tok;
+      return (*this)(next, end, tok);
+    }
+
+  private:
+    typedef tokenizer_detail::swar swar;
+    enum { space_class = 1, punct_class = 2 };
+
+    // The length of a run after which the rest of it is passed over in
+    // blocks.
+    BOOST_STATIC_CONSTANT(std::ptrdiff_t, long_run = 16);
+
+    static unsigned char class_of(char c) {
+      return tokenizer_detail::ascii_classes<void>::table[
+        static_cast<unsigned char>(c)];
+    }
+
+    bool is_dropped(char c) const { return (class_of(c) & m_dropped) != 0; }
+    bool is_kept(char c) const { return (class_of(c) & m_kept) != 0; }
+    bool is_word(char c) const { return class_of(c) == 0; }
+
+    bool all_dropped(swar::word x) const {
+      swar::word m = swar::ascii_space(x);
+      if (!m_keep_punct)
+        m |= swar::ascii_punct(x);
+      return m == swar::high();
+    }
+
+    // Each of the following looks up the first long_run chars one at a
+    // time, and leaves a run that goes on past them to the long_ version,
+    // which is kept apart so that the short loop is inlined.
+    const char* skip_dropped(const char* p, const char* e) const {
+      const char* stop = e - p > long_run ? p + long_run : e;
+      while (p != stop && is_dropped(*p))
+        ++p;
+      return p != stop || p == e ? p : long_skip_dropped(p, e);
+    }
+
+    const char* word_end(const char* p, const char* e) const {
+      const char* stop = e - p > long_run ? p + long_run : e;
+      while (p != stop && is_word(*p))
+        ++p;
+      return p != stop || p == e ? p : long_word_end(p, e);
+    }
+
+    // Each of the following passes whole blocks of eight chars while the
+    // block test allows it, then finishes within one block a char at a
+    // time. If that char by char pass reaches the end of the block, the
+    // block test was only conservative, and the search goes on.
+    BOOST_NOINLINE const char* long_skip_dropped(const char* p,
+                                                 const char* e) const {
+      for (;;) {
+        while (e - p >= 8 && all_dropped(swar::load(p)))
+          p += 8;
+        const char* stop = e - p >= 8 ? p + 8 : e;
+        while (p != stop && is_dropped(*p))
+          ++p;
+        if (p != stop || p == e)
+          return p;
+      }
+    }
+
+    BOOST_NOINLINE const char* long_word_end(const char* p,
+                                             const char* e) const {
+      for (;;) {
+        while (e - p >= 8 && swar::maybe_delimiter(swar::load(p)) == 0)
+          p += 8;
+        const char* stop = e - p >= 8 ? p + 8 : e;
+        while (p != stop && is_word(*p))
+          ++p;
+        if (p != stop || p == e)
+          return p;
+      }
+    }
+
+    template <typename Iterator, typename Token>
+    bool scan(Iterator& next, Iterator end, Token& tok,
+              std::random_access_iterator_tag, true_type) const
+    {
+      if (next == end)
+        return false;
+      const char* base = &*next;
+      const char* e = base + (end - next);
+      const char* p = skip_dropped(base, e);
+      if (p == e) {
+        next = end;
+        return false;
+      }
+      bool kept = is_kept(*p);
+      const char* q = kept ? p + 1 : word_end(p, e);
+      Iterator start = next + (p - base);
+      next += q - base;
+      tok.assign(start, next);
+      tokenizer_detail::token_kind_traits<Token>::set(
+        tok, kept ? delimiter_token : data_token);
+      return true;
+    }
+
+    template <typename InputIterator, typename Token, typename Category>
+    bool scan(InputIterator& next, InputIterator end, Token& tok,
+              Category, false_type) const
+    {
+      typedef tokenizer_detail::assign_or_plus_equal<Category> assigner;
+      typedef tokenizer_detail::token_kind_traits<Token> kind;
+
+      assigner::clear(tok);
+      kind::set(tok, data_token);
+      for (; next != end && is_dropped(*next); ++next) { }
+      if (next == end)
+        return false;
+      InputIterator start(next);
+      if (is_kept(*next)) {
+        assigner::plus_equal(tok, *next);
+        kind::set(tok, delimiter_token);
+        ++next;
+      }
+      else {
+        for (; next != end && is_word(*next); ++next)
+          assigner::plus_equal(tok, *next);
+      }
+      assigner::assign(start, next, tok);
+      return true;
+    }
+
+    // An iterator category derived from random access is read a char at a
+    // time.
+    template <typename Iterator, typename Token, typename Category>
+    bool scan(Iterator& next, Iterator end, Token& tok,
+              Category category, true_type) const
+    {
+      return scan(next, end, tok, category, false_type());
+    }
+
+    unsigned char m_dropped;
+    unsigned char m_kept;
+    bool m_keep_punct;
+  };
+
+  template <>
+  struct has_token_skip<ascii_word_separator> : public true_type { };
+
+  namespace tokenizer_detail {
+  // ascii_word_separator has no state at all.
+  template <>
+  class separator_state<ascii_word_separator> {
+  public:
+    explicit separator_state(const ascii_word_separator&) { }
+    void restore(ascii_word_separator&) const { }
+    static bool resumes_at_token(const ascii_word_separator&) {
+      return true;
+    }
+  };
+  } // namespace tokenizer_detail
+
+} // namespace boost
+
+#endif
@@ -0,0 +1,234 @@
+// Boost tokenizer/buffered_tokenize.hpp  -----------------------------------//
+
+// Copyright 2026 Boost.Tokenizer contributors.
+
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// See http://www.boost.org/libs/tokenizer for documentation.
+
+#ifndef BOOST_TOKENIZER_BUFFERED_TOKENIZE_HPP_
+#define BOOST_TOKENIZER_BUFFERED_TOKENIZE_HPP_
+
+#include <algorithm>
+#include <cstddef>
+#include <istream>
+#include <iterator>
+#include <string>
+#include <vector>
+#include <boost/config.hpp>
+#include <boost/token_functions.hpp>
+
+namespace boost {
+
+  namespace tokenizer_detail {
+
+  // Reads up to n characters of [first, last) into out.
+  template <class InputIterator>
+  struct iterator_reader {
+    InputIterator first;
+    InputIterator last;
+
+    template <class Char>
+    std::size_t operator()(Char* out, std::size_t n) {
+      std::size_t i = 0;
+      for (; i < n && first != last; ++i, ++first)
+        out[i] = *first;
+      return i;
+    }
+  };
+
+  // Reads up to n characters from a stream buffer, in one sgetn.
+  template <class Char, class Tr>
+  struct streambuf_reader {
+    std::basic_streambuf<Char,Tr>* buf;
+
+    std::size_t operator()(Char* out, std::size_t n) {
+      return buf ? static_cast<std::size_t>(
+        buf->sgetn(out, static_cast<std::streamsize>(n))) : 0;
+    }
+  };
+
+  // The token buffered_scan passes to f: a string, which also records
+  // where in the window the token starts, if f says so by assigning it or
+  // through token_location_traits.
+  template <class Char>
+  class window_token {
+  public:
+    typedef std::basic_string<Char> string_type;
+
+    window_token() : first_(0) { }
+
+    void assign(const Char* first, const Char* last) {
+      first_ = first;
+      value_.assign(first, last);
+    }
+
+    template <class Value>
+    window_token& operator+=(const Value& c) {
+      value_ += c;
+      return *this;
+    }
+
+    void clear() { value_.clear(); }
+
+    void locate(const Char* first) { first_ = first; }
+    const Char* first() const { return first_; }
+
+    const string_type& value() const { return value_; }
+
+  private:
+    const Char* first_;
+    string_type value_;
+  };
+
+  template <class Char>
+  struct token_clear_traits<window_token<Char> > {
+    static void clear(window_token<Char>& t) { t.clear(); }
+  };
+
+  template <class Char>
+  struct token_location_traits<window_token<Char> > {
+    template <class Iterator>
+    static void set(window_token<Char>& t, const Iterator& first,
+                    const Iterator&) {
+      t.locate(first);
+    }
+  };
+
+  //===========================================================================
+  // The loop of tokenize_buffered. The input is read a window at a time,
+  // and f runs over the window with pointers. A token that reaches the end
+  // of the window may go on past it, so then f is put back as it was
+  // before the token, the unread part of the window is moved to its front
+  // and more is read, and the token is found again. An escaped_list_error
+  // with f at the end of the window, which is how an escape cut in two
+  // shows, is retried the same way; any other exception reaches the
+  // caller as it is.
+  //
+  // When f resumes at a token, the delimiters it passed over
+  // are not kept: the part of the window that is kept starts at the
+  // token, and a window in which f found no token is dropped whole. So
+  // the window only grows when a single token does not fit in it.
+  template <class Char, class Reader, class TokenizerFunc, class Sink>
+  void buffered_scan(Reader& read, TokenizerFunc& f, Sink& sink,
+                     std::size_t lookahead)
+  {
+    typedef separator_state<TokenizerFunc> state_type;
+    const bool resumes = state_type::resumes_at_token(f);
+
+    std::vector<Char> window(lookahead ? lookahead : 1);
+    std::size_t pos = 0;
+    std::size_t size = 0;
+    bool eof = false;
+    window_token<Char> tok;
+    f.reset();
+
+    // As for a tokenizer, empty input has no tokens.
+    size = read(&window[0], window.size());
+    if (size == 0)
+      return;
+
+    for (;;) {
+      if (!eof && pos == size) {
+        pos = 0;
+        size = read(&window[0], window.size());
+        eof = size == 0;
+      }
+
+      const Char* first = &window[0] + pos;
+      const Char* last = &window[0] + size;
+      const Char* next = first;
+      state_type before(f);
+      tok.locate(0);
+      bool found;
+      bool short_window;
+      bool failed = false;
+      try {
+        found = f(next, last, tok);
+        short_window = !eof && next == last;
+      }
+      catch (const escaped_list_error&) {
+        if (eof || next != last)
+          throw;
+        short_window = true;
+        found = false;
+        failed = true;
+      }
+
+      if (short_window) {
+        before.restore(f);
+        // Where the part of the window to keep starts.
+        const Char* keep = first;
+        if (resumes && !failed) {
+          if (!found)
+            keep = last;
+          else if (tok.first())
+            keep = tok.first();
+        }
+        pos = static_cast<std::size_t>(keep - &window[0]);
+        if (pos == 0 && size == window.size())
+          window.resize(window.size() * 2);
+        else {
+          std::copy(window.begin() + pos, window.begin() + size,
+                    window.begin());
+          size -= pos;
+          pos = 0;
+        }
+        std::size_t n = read(&window[0] + size, window.size() - size);
+        size += n;
+        eof = n == 0;
+        continue;
+      }
+
+      if (!found)
+        return;
+      sink(tok.value());
+      pos = static_cast<std::size_t>(next - &window[0]);
+    }
+  }
+
+  } // namespace tokenizer_detail
+
+
+  //===========================================================================
+  // tokenize_buffered finds the tokens of an input range with f, as a
+  // tokenizer over it would, and passes each of them to sink as a const
+  // std::basic_string&, which is reused for the next token. Instead of
+  // running f over the input iterators, which for input iterators makes
+  // f build each token a character at a time, it reads the input into a
+  // buffer of lookahead characters and runs f over the buffer with
+  // pointers, so that tokens are assigned in one piece and the input is
+  // read a block at a time. The buffer grows past lookahead
+  // only to hold a token that is longer, or, for TokenizerFunctions that
+  // cannot resume at a token (see separator_state), a token and the
+  // delimiters before it. f must be copyable, and must not look beyond
+  // the end of the token it returns, which holds for all the
+  // TokenizerFunctions in this library.
+  //
+  // The stream overload reads from in.rdbuf() with sgetn, as an
+  // istreambuf_iterator would, and does not change the state of in.
+
+  template <class InputIterator, class TokenizerFunc, class Sink>
+  void tokenize_buffered(InputIterator first, InputIterator last,
+                         TokenizerFunc f, Sink sink,
+                         std::size_t lookahead = 4096)
+  {
+    typedef BOOST_DEDUCED_TYPENAME
+      std::iterator_traits<InputIterator>::value_type char_type;
+    tokenizer_detail::iterator_reader<InputIterator> read = { first, last };
+    tokenizer_detail::buffered_scan<char_type>(read, f, sink, lookahead);
+  }
+
+  template <class Char, class Tr, class TokenizerFunc, class Sink>
+  void tokenize_buffered(std::basic_istream<Char,Tr>& in, TokenizerFunc f,
+                         Sink sink, std::size_t lookahead = 4096)
+  {
+    tokenizer_detail::streambuf_reader<Char,Tr> read = { in.rdbuf() };
+    tokenizer_detail::buffered_scan<Char>(read, f, sink, lookahead);
+  }
+
+} // namespace boost
+
+#endif
@@ -0,0 +1,255 @@
+// Boost tokenizer/chunked_tokenizer.hpp  -----------------------------------//
+
+// Copyright 2026 Boost.Tokenizer contributors.
+
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// See http://www.boost.org/libs/tokenizer for documentation.
+
+#ifndef BOOST_TOKENIZER_CHUNKED_TOKENIZER_HPP_
+#define BOOST_TOKENIZER_CHUNKED_TOKENIZER_HPP_
+
+#include <boost/tokenizer/detail/config.hpp>
+
+#if defined(BOOST_TOKENIZER_HAS_COROUTINES)
+
+#include <coroutine>
+#include <exception>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <boost/assert.hpp>
+#include <boost/token_functions.hpp>
+#include <boost/tokenizer/push_tokenizer.hpp>
+
+namespace boost {
+
+  namespace tokenizer_detail {
+
+  //===========================================================================
+  // The input of a chunked scan: the part of the current chunk that has not
+  // been read yet, and whether the last chunk has been seen.
+  template <class Char>
+  struct chunk_source {
+    const Char* next = nullptr;
+    const Char* end = nullptr;
+    bool eof = false;
+  };
+
+  // The coroutine type of a chunked scan. It suspends either to hand out a
+  // token or, with starved set, to wait for the next chunk.
+  template <class Char>
+  class chunk_task {
+  public:
+    struct promise_type {
+      std::basic_string_view<Char> token;
+      bool starved = false;
+      std::exception_ptr error;
+
+      chunk_task get_return_object() {
+        return chunk_task(handle::from_promise(*this));
+      }
+      std::suspend_always initial_suspend() noexcept { return {}; }
+      std::suspend_always final_suspend() noexcept { return {}; }
+      std::suspend_always yield_value(std::basic_string_view<Char> t) noexcept {
+        token = t;
+        starved = false;
+        return {};
+      }
+      void return_void() noexcept { }
+      void unhandled_exception() { error = std::current_exception(); }
+    };
+
+    typedef std::coroutine_handle<promise_type> handle;
+
+    // co_await more_input() suspends the scan until feed() or finish().
+    struct more_input {
+      bool await_ready() const noexcept { return false; }
+      void await_suspend(handle h) const noexcept { h.promise().starved = true; }
+      void await_resume() const noexcept { }
+    };
+
+    chunk_task() = default;
+    chunk_task(chunk_task&& other) noexcept
+      : h_(std::exchange(other.h_, handle())) { }
+    chunk_task& operator=(chunk_task&& other) noexcept {
+      if (this != &other) {
+        destroy();
+        h_ = std::exchange(other.h_, handle());
+      }
+      return *this;
+    }
+    ~chunk_task() { destroy(); }
+
+    // Runs the scan to its next suspension point. Returns true if it
+    // produced a token, false if it needs more input or is finished.
+    bool resume() {
+      if (!h_ || h_.done())
+        return false;
+      h_.resume();
+      if (h_.promise().error)
+        std::rethrow_exception(std::exchange(h_.promise().error, nullptr));
+      return !h_.done() && !h_.promise().starved;
+    }
+
+    bool done() const { return !h_ || h_.done(); }
+    std::basic_string_view<Char> token() const { return h_.promise().token; }
+
+  private:
+    explicit chunk_task(handle h) : h_(h) { }
+    void destroy() {
+      if (h_)
+        h_.destroy();
+      h_ = handle();
+    }
+
+    handle h_;
+  };
+
+  // The token chunk_scan passes to push_token: a view of the range it is
+  // assigned from, which is either the chunk or the input kept in the
+  // push_state, and so stays valid until the scan is resumed. Functions
+  // without a push member that build their tokens a character at a time
+  // build them in a buffer of the token.
+  template <class Char>
+  class chunk_token {
+  public:
+    void assign(const Char* first, const Char* last) {
+      view_ = std::basic_string_view<Char>(first, last - first);
+    }
+
+    template <class Value>
+    chunk_token& operator+=(const Value& c) {
+      buffer_ += c;
+      view_ = buffer_;
+      return *this;
+    }
+
+    void clear() {
+      buffer_.clear();
+      view_ = std::basic_string_view<Char>();
+    }
+
+    std::basic_string_view<Char> value() const { return view_; }
+
+  private:
+    std::basic_string_view<Char> view_;
+    std::basic_string<Char> buffer_;
+  };
+
+  template <class Char>
+  struct token_clear_traits<chunk_token<Char> > {
+    static void clear(chunk_token<Char>& t) { t.clear(); }
+  };
+
+  // The coroutine of a chunked scan. The state of the parse lives in its
+  // frame, as a push_state: the state of f between tokens, and the token
+  // that the end of the last chunk has cut in two, with where f's parsing
+  // loop stands inside it. Each chunk is pushed through f from there, so
+  // every character is read once, and the scan suspends whenever the
+  // chunk is used up.
+  template <class TokenizerFunc, class Char>
+  chunk_task<Char> chunk_scan(TokenizerFunc f, chunk_source<Char>* src)
+  {
+    typedef typename chunk_task<Char>::more_input more_input;
+    push_state<TokenizerFunc, Char> state(f);
+    chunk_token<Char> tok;
+
+    for (;;) {
+      if (push_token(f, state, src->next, src->end, tok))
+        co_yield tok.value();
+      else if (!src->eof)
+        co_await more_input();
+      else
+        break;
+    }
+    while (finish_tokens(f, state, tok))
+      co_yield tok.value();
+  }
+
+  } // namespace tokenizer_detail
+
+
+  //===========================================================================
+  // The chunked_tokenizer class tokenizes input that arrives in pieces, such
+  // as data read from a socket or a pipe, without first collecting it into
+  // one string. It produces the same tokens as a tokenizer over the
+  // concatenation of all the chunks.
+  //
+  //   chunked_tokenizer<char_separator<char> > t(sep);
+  //   while (read(buf)) {
+  //     t.feed(buf);
+  //     while (t.next(tok)) use(tok);
+  //   }
+  //   t.finish();
+  //   while (t.next(tok)) use(tok);
+  //
+  // Tokens are returned as views that stay valid until the next call to
+  // next() or feed(). A chunk must stay alive, and must not be replaced by
+  // another feed(), until next() has returned false.
+  //
+  // The scan is a C++20 coroutine whose frame holds the state of the
+  // parse. It pushes each chunk through the TokenizerFunction, as
+  // push_token does, going on with a token that the last chunk cut in two
+  // from where the function's parsing loop stopped, and suspends whenever
+  // the chunk is used up. Any TokenizerFunction that can be pushed can be
+  // used.
+  template <class TokenizerFunc, class Char = char>
+  class chunked_tokenizer {
+    typedef Char char_type;
+
+  public:
+    typedef std::basic_string_view<char_type> value_type;
+
+    explicit chunked_tokenizer(const TokenizerFunc& f = TokenizerFunc())
+      : src_(new tokenizer_detail::chunk_source<char_type>()),
+        task_(tokenizer_detail::chunk_scan(f, src_.get())),
+        waiting_(false) { }
+
+    chunked_tokenizer(chunked_tokenizer&&) = default;
+    chunked_tokenizer& operator=(chunked_tokenizer&&) = default;
+
+    // Makes chunk the next piece of input.
+    void feed(value_type chunk) {
+      BOOST_ASSERT(src_->next == src_->end && !src_->eof);
+      src_->next = chunk.data();
+      src_->end = chunk.data() + chunk.size();
+      waiting_ = false;
+    }
+
+    // Marks the end of the input, so that the last token can be completed.
+    void finish() {
+      src_->eof = true;
+      waiting_ = false;
+    }
+
+    // Gets the next token that is complete. Returns false when more input
+    // is needed, or when finish() was called and all tokens were returned.
+    bool next(value_type& tok) {
+      if (waiting_)
+        return false;
+      if (!task_.resume()) {
+        waiting_ = true;
+        return false;
+      }
+      tok = task_.token();
+      return true;
+    }
+
+    // True once finish() was called and all tokens were returned.
+    bool done() const { return task_.done(); }
+
+  private:
+    std::unique_ptr<tokenizer_detail::chunk_source<char_type> > src_;
+    tokenizer_detail::chunk_task<char_type> task_;
+    bool waiting_;
+  };
+
+} // namespace boost
+
+#endif // BOOST_TOKENIZER_HAS_COROUTINES
+
+#endif
@@ -0,0 +1,241 @@
+// Boost tokenizer/constexpr_tokenize.hpp  ----------------------------------//
+
+// Copyright 2026 Boost.Tokenizer contributors.
+
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// See http://www.boost.org/libs/tokenizer for documentation.
+
+#ifndef BOOST_TOKENIZER_CONSTEXPR_TOKENIZE_HPP_
+#define BOOST_TOKENIZER_CONSTEXPR_TOKENIZE_HPP_
+
+#include <boost/tokenizer/detail/config.hpp>
+
+#if defined(BOOST_TOKENIZER_HAS_STRING_VIEW)
+
+#include <array>
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <boost/throw_exception.hpp>
+#include <boost/token_functions.hpp>
+#include <boost/tokenizer/token_view.hpp>
+
+namespace boost {
+
+  //===========================================================================
+  // The constexpr_char_separator class is a model of TokenizerFunction
+  // that finds the same tokens as char_separator, with the same parsing
+  // loop, but refers to its delimiter lists instead of copying them, so
+  // that it can be used in constant expressions. There is no default
+  // constructor, since isspace() and ispunct() depend on the locale. The
+  // delimiter lists must outlive the separator; string literals do.
+  // Requires forward iterators.
+
+  template <class Char,
+    class Tr = typename std::basic_string<Char>::traits_type>
+  class constexpr_char_separator {
+  public:
+    typedef Char char_type;
+
+    explicit constexpr constexpr_char_separator(
+        const Char* dropped_delims, const Char* kept_delims = nullptr,
+        empty_token_policy empty_tokens = drop_empty_tokens)
+      : m_dropped_delims(dropped_delims),
+        m_kept_delims(kept_delims ? view_type(kept_delims) : view_type()),
+        m_empty_tokens(empty_tokens),
+        m_output_done(false) { }
+
+    constexpr void reset() { m_output_done = false; }
+
+    template <typename Iterator, typename Token>
+    constexpr bool operator()(Iterator& next, Iterator end, Token& tok) {
+      return char_separator<Char,Tr>::scan(*this, m_empty_tokens,
+                                           m_output_done, next, end, tok);
+    }
+
+    // Like operator(), but only finds the end of the token.
+    template <typename Iterator>
+    constexpr bool skip(Iterator& next, Iterator end) {
+      token_view<Iterator> tok;
+      return (*this)(next, end, tok);
+    }
+
+    constexpr bool is_dropped(Char c) const {
+      return m_dropped_delims.find(c) != view_type::npos;
+    }
+    constexpr bool is_kept(Char c) const {
+      return m_kept_delims.find(c) != view_type::npos;
+    }
+    constexpr bool is_delimiter(Char c) const {
+      return is_dropped(c) || is_kept(c);
+    }
+    constexpr unsigned delimiter_mask(Char c) const {
+      return (is_dropped(c) ? unsigned(tokenizer_detail::dropped_delimiter)
+                            : 0u) |
+        (is_kept(c) ? unsigned(tokenizer_detail::kept_delimiter) : 0u);
+    }
+
+  private:
+    typedef std::basic_string_view<Char,Tr> view_type;
+
+    view_type m_dropped_delims;
+    view_type m_kept_delims;
+    empty_token_policy m_empty_tokens;
+    bool m_output_done;
+  };
+
+  template <class Char, class Tr>
+  struct has_token_skip<constexpr_char_separator<Char,Tr> >
+    : public true_type { };
+
+
+  //===========================================================================
+  // The constexpr_offset_separator class is a model of TokenizerFunction
+  // that finds the same tokens as offset_separator, with the same parsing
+  // loop, and keeps its N offsets in an array, so that it can be used in
+  // constant expressions. Requires forward iterators.
+
+  template <std::size_t N>
+  class constexpr_offset_separator {
+  public:
+    static_assert(N != 0, "constexpr_offset_separator needs an offset");
+
+    explicit constexpr constexpr_offset_separator(
+        const int (&offsets)[N], bool wrap_offsets = true,
+        bool return_partial_last = true)
+      : offsets_(), current_offset_(0), wrap_offsets_(wrap_offsets),
+        return_partial_last_(return_partial_last)
+    {
+      for (std::size_t i = 0; i < N; ++i)
+        offsets_[i] = offsets[i];
+    }
+
+    constexpr void reset() { current_offset_ = 0; }
+
+    template <typename Iterator, typename Token>
+    constexpr bool operator()(Iterator& next, Iterator end, Token& tok) {
+      return offset_separator::scan(offsets_.data(), N, wrap_offsets_,
+                                    return_partial_last_, current_offset_,
+                                    next, end, tok);
+    }
+
+    // Like operator(), but only finds the end of the token.
+    template <typename Iterator>
+    constexpr bool skip(Iterator& next, Iterator end) {
+      token_view<Iterator> tok;
+      return (*this)(next, end, tok);
+    }
+
+  private:
+    std::array<int, N> offsets_;
+    unsigned int current_offset_;
+    bool wrap_offsets_;
+    bool return_partial_last_;
+  };
+
+  template <std::size_t N>
+  struct has_token_skip<constexpr_offset_separator<N> > : public true_type { };
+
+
+  //===========================================================================
+  // A token_array holds up to N tokens as string views of the input, in a
+  // std::array, so that it can be the value of a constant expression.
+  // Pushing more than N tokens fails to compile in a constant expression
+  // and throws std::length_error at run time.
+
+  template <class Char, std::size_t N,
+    class Tr = typename std::basic_string<Char>::traits_type>
+  class token_array {
+  public:
+    typedef std::basic_string_view<Char,Tr> value_type;
+    typedef const value_type* const_iterator;
+    typedef const value_type* iterator;
+    typedef std::size_t size_type;
+
+    constexpr token_array() : tokens_(), size_(0) { }
+
+    constexpr size_type size() const { return size_; }
+    constexpr bool empty() const { return size_ == 0; }
+    static constexpr size_type capacity() { return N; }
+
+    constexpr const value_type& operator[](size_type i) const {
+      return tokens_[i];
+    }
+    constexpr const_iterator begin() const { return tokens_.data(); }
+    constexpr const_iterator end() const { return tokens_.data() + size_; }
+
+    // throw_exception is not constexpr, so reaching it when the array is
+    // full is ill-formed in a constant expression.
+    constexpr void push_back(value_type tok) {
+      if (size_ == N)
+        BOOST_THROW_EXCEPTION(std::length_error(
+          "token_array: too many tokens"));
+      tokens_[size_++] = tok;
+    }
+
+  private:
+    std::array<value_type, N> tokens_;
+    size_type size_;
+  };
+
+  // Finds the tokens of s with f, and returns them in a token_array of
+  // capacity N. Can be evaluated at compile time with the constexpr
+  // separators above. Like token_iterator, finds no tokens in empty input.
+  template <std::size_t N, class TokenizerFunc, class Char, class Tr>
+  constexpr token_array<Char, N, Tr>
+  make_token_array(std::basic_string_view<Char,Tr> s, TokenizerFunc f)
+  {
+    token_array<Char, N, Tr> tokens;
+    if (s.empty())
+      return tokens;
+    const Char* next = s.data();
+    const Char* end = next + s.size();
+    token_view<const Char*> tok;
+    f.reset();
+    while (f(next, end, tok))
+      tokens.push_back(std::basic_string_view<Char,Tr>(tok.begin(),
+                                                       tok.size()));
+    return tokens;
+  }
+
+#if defined(BOOST_TOKENIZER_HAS_CLASS_TEMPLATE_ARGS)
+
+  namespace tokenizer_detail {
+
+  // A string literal that can be a template argument.
+  template <class Char, std::size_t N>
+  struct delimiter_literal {
+    Char chars[N];
+
+    constexpr delimiter_literal(const Char (&s)[N]) : chars() {
+      for (std::size_t i = 0; i < N; ++i)
+        chars[i] = s[i];
+    }
+  };
+
+  } // namespace tokenizer_detail
+
+  // Splits a string literal at the dropped delimiters Delims, dropping
+  // empty tokens, as char_separator<Char>(Delims) does:
+  //
+  //   constexpr auto cols = boost::tokenize<",">("a,b,c");
+  //   static_assert(cols.size() == 3 && cols[1] == "b");
+  template <tokenizer_detail::delimiter_literal Delims, class Char,
+            std::size_t N>
+  constexpr token_array<Char, N> tokenize(const Char (&s)[N])
+  {
+    return make_token_array<N>(std::basic_string_view<Char>(s, N - 1),
+      constexpr_char_separator<Char>(Delims.chars));
+  }
+
+#endif
+
+} // namespace boost
+
+#endif // BOOST_TOKENIZER_HAS_STRING_VIEW
+
+#endif
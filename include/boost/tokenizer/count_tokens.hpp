@@ -0,0 +1,69 @@
+// Boost tokenizer/count_tokens.hpp  ----------------------------------------//
+
+// Copyright 2026 Boost.Tokenizer contributors.
+
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// See http://www.boost.org/libs/tokenizer for documentation.
+
+#ifndef BOOST_TOKENIZER_COUNT_TOKENS_HPP_
+#define BOOST_TOKENIZER_COUNT_TOKENS_HPP_
+
+#include <cstddef>
+#include <iterator>
+#include <string>
+#include <boost/token_functions.hpp>
+
+namespace boost {
+
+  //===========================================================================
+  // count_tokens returns the number of tokens a tokenizer over the same
+  // sequence and TokenizerFunction would produce, without building any of
+  // them. char_separator and escaped_list_separator count with a single
+  // classification pass over the input; other TokenizerFunctions are run
+  // token by token, using their skip member when they have one, and
+  // otherwise building each token into a basic_string of the sequence's
+  // value type.
+
+  template <class Iterator, class TokenizerFunc>
+  std::size_t count_tokens(Iterator first, Iterator last, TokenizerFunc f)
+  {
+    typedef tokenizer_detail::token_skipper<
+      has_token_skip<TokenizerFunc>::value> skipper;
+    std::size_t n = 0;
+    if (first == last)
+      return n;
+    f.reset();
+    std::basic_string<
+      BOOST_DEDUCED_TYPENAME std::iterator_traits<Iterator>::value_type
+    > scratch;
+    while (skipper::skip(f, first, last, scratch))
+      ++n;
+    return n;
+  }
+
+  template <class Iterator, class Char, class Tr>
+  std::size_t count_tokens(Iterator first, Iterator last,
+                           const char_separator<Char,Tr>& f)
+  {
+    return f.count(first, last);
+  }
+
+  template <class Iterator, class Char, class Traits>
+  std::size_t count_tokens(Iterator first, Iterator last,
+                           const escaped_list_separator<Char,Traits>& f)
+  {
+    return f.count(first, last);
+  }
+
+  template <class Container, class TokenizerFunc>
+  std::size_t count_tokens(const Container& c, const TokenizerFunc& f)
+  {
+    return count_tokens(c.begin(), c.end(), f);
+  }
+
+} // namespace boost
+
+#endif
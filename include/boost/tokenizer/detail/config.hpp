@@ -0,0 +1,68 @@
+// Boost tokenizer/detail/config.hpp  ---------------------------------------//
+
+// Copyright 2026 Boost.Tokenizer contributors.
+
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// See http://www.boost.org/libs/tokenizer for documentation.
+
+#ifndef BOOST_TOKENIZER_DETAIL_CONFIG_HPP_
+#define BOOST_TOKENIZER_DETAIL_CONFIG_HPP_
+
+#include <boost/config.hpp>
+
+// The parts of the library that need a newer standard are only defined when
+// the compiler and the standard library provide what they use. The feature
+// test macros are checked directly, since not every version of Boost.Config
+// knows about the newer headers.
+
+#if defined(_MSVC_LANG)
+#  define BOOST_TOKENIZER_CPLUSPLUS _MSVC_LANG
+#else
+#  define BOOST_TOKENIZER_CPLUSPLUS __cplusplus
+#endif
+
+#if BOOST_TOKENIZER_CPLUSPLUS < 201703L && !defined(BOOST_TOKENIZER_NO_CXX17)
+#  define BOOST_TOKENIZER_NO_CXX17
+#endif
+
+#if !defined(BOOST_TOKENIZER_NO_CXX17) && defined(__has_include)
+#  if __has_include(<version>)
+#    include <version>
+#  endif
+#endif
+
+#if !defined(BOOST_TOKENIZER_NO_CXX17) && \
+    !defined(BOOST_NO_CXX17_HDR_STRING_VIEW)
+#  define BOOST_TOKENIZER_HAS_STRING_VIEW
+#endif
+
+#if defined(BOOST_TOKENIZER_HAS_STRING_VIEW) && \
+    defined(__cpp_impl_coroutine) && defined(__cpp_lib_coroutine)
+#  define BOOST_TOKENIZER_HAS_COROUTINES
+#endif
+
+// std::from_chars for both integers and floating point numbers.
+#if defined(BOOST_TOKENIZER_HAS_STRING_VIEW) && \
+    defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
+#  define BOOST_TOKENIZER_HAS_FROM_CHARS
+#endif
+
+// Class types, such as string literals wrapped in a class, as template
+// arguments.
+#if defined(BOOST_TOKENIZER_HAS_STRING_VIEW) && \
+    defined(__cpp_nontype_template_args) && \
+    __cpp_nontype_template_args >= 201911L
+#  define BOOST_TOKENIZER_HAS_CLASS_TEMPLATE_ARGS
+#endif
+
+// Concepts and the <ranges> library.
+#if defined(BOOST_TOKENIZER_HAS_STRING_VIEW) && \
+    defined(__cpp_concepts) && defined(__cpp_lib_ranges) && \
+    __cpp_lib_ranges >= 201911L
+#  define BOOST_TOKENIZER_HAS_RANGES
+#endif
+
+#endif
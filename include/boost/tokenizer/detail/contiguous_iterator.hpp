@@ -0,0 +1,43 @@
+// Boost tokenizer/detail/contiguous_iterator.hpp  --------------------------//
+
+// Copyright 2026 Boost.Tokenizer contributors.
+
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// See http://www.boost.org/libs/tokenizer for documentation.
+
+#ifndef BOOST_TOKENIZER_DETAIL_CONTIGUOUS_ITERATOR_HPP_
+#define BOOST_TOKENIZER_DETAIL_CONTIGUOUS_ITERATOR_HPP_
+
+#include <string>
+#include <vector>
+#include <boost/config.hpp>
+#include <boost/type_traits/integral_constant.hpp>
+#include <boost/type_traits/is_same.hpp>
+
+namespace boost {
+  namespace tokenizer_detail {
+
+  // Whether the elements of [next, end) are known to be Chars contiguous
+  // in memory, so that the separators can search them a block at a time.
+  // Pointers to other types are not, since &*next must be a Char*.
+  template <class Iterator, class Char>
+  struct is_contiguous_iterator : public integral_constant<bool,
+    is_same<Iterator, Char*>::value ||
+    is_same<Iterator, const Char*>::value ||
+    is_same<Iterator,
+      BOOST_DEDUCED_TYPENAME std::basic_string<Char>::iterator>::value ||
+    is_same<Iterator,
+      BOOST_DEDUCED_TYPENAME std::basic_string<Char>::const_iterator>::value ||
+    is_same<Iterator,
+      BOOST_DEDUCED_TYPENAME std::vector<Char>::iterator>::value ||
+    is_same<Iterator,
+      BOOST_DEDUCED_TYPENAME std::vector<Char>::const_iterator>::value>
+  { };
+
+  } // namespace tokenizer_detail
+} // namespace boost
+
+#endif
@@ -0,0 +1,221 @@
+// Boost tokenizer/indexed_tokenizer.hpp  -----------------------------------//
+
+// Copyright 2026 Boost.Tokenizer contributors.
+
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// See http://www.boost.org/libs/tokenizer for documentation.
+
+#ifndef BOOST_TOKENIZER_INDEXED_TOKENIZER_HPP_
+#define BOOST_TOKENIZER_INDEXED_TOKENIZER_HPP_
+
+#include <cstddef>
+#include <iterator>
+#include <vector>
+#include <string>
+#include <stdexcept>
+#include <boost/assert.hpp>
+#include <boost/throw_exception.hpp>
+#include <boost/iterator/iterator_facade.hpp>
+#include <boost/token_functions.hpp>
+
+namespace boost {
+
+  //===========================================================================
+  // A random access container-view of a tokenized sequence.
+  //
+  // The first call that needs to know where the tokens are (begin(), end(),
+  // size(), operator[], ...) scans the whole sequence once and records, for
+  // every token, the position it starts scanning from and the state of the
+  // TokenizerFunction at that point. A token is only built the first time it
+  // is accessed, by running a copy of the TokenizerFunction from its recorded
+  // position; the result is kept, so repeated access to the same field costs
+  // nothing.
+  //
+  // The iterators must be forward iterators, since every token is read
+  // twice. Because tokens are built lazily, a const indexed_tokenizer must
+  // not be used from several threads at once.
+  template <
+    typename TokenizerFunc = char_delimiters_separator<char>,
+    typename Iterator = std::string::const_iterator,
+    typename Type = std::string
+  >
+  class indexed_tokenizer {
+  private:
+    typedef tokenizer_detail::separator_state<TokenizerFunc> state_type;
+
+    struct entry {
+      entry(Iterator p, const state_type& s) : pos(p), state(s) { }
+      Iterator pos;
+      state_type state;
+    };
+
+  public:
+    typedef Type value_type;
+    typedef const value_type& reference;
+    typedef const value_type& const_reference;
+    typedef const value_type* pointer;
+    typedef const value_type* const_pointer;
+    typedef std::size_t size_type;
+    typedef std::ptrdiff_t difference_type;
+
+    class iterator
+      : public iterator_facade<
+            iterator
+          , const Type
+          , random_access_traversal_tag
+          , const Type&
+          , std::ptrdiff_t
+        >
+    {
+      friend class iterator_core_access;
+      friend class indexed_tokenizer;
+
+      const indexed_tokenizer* t_;
+      std::size_t i_;
+
+      iterator(const indexed_tokenizer* t, std::size_t i) : t_(t), i_(i) { }
+
+      const Type& dereference() const { return (*t_)[i_]; }
+      bool equal(const iterator& other) const { return i_ == other.i_; }
+      void increment() { ++i_; }
+      void decrement() { --i_; }
+      void advance(std::ptrdiff_t n) { i_ += n; }
+      std::ptrdiff_t distance_to(const iterator& other) const {
+        return static_cast<std::ptrdiff_t>(other.i_) -
+               static_cast<std::ptrdiff_t>(i_);
+      }
+
+    public:
+      iterator() : t_(0), i_(0) { }
+
+      // The position of the token in the sequence.
+      std::size_t index() const { return i_; }
+    };
+
+    typedef iterator const_iterator;
+    typedef std::reverse_iterator<iterator> reverse_iterator;
+    typedef reverse_iterator const_reverse_iterator;
+
+    indexed_tokenizer(Iterator first, Iterator last,
+                      const TokenizerFunc& f = TokenizerFunc())
+      : first_(first), last_(last), f_(f), indexed_(false) { }
+
+    template <typename Container>
+    indexed_tokenizer(const Container& c)
+      : first_(c.begin()), last_(c.end()), f_(), indexed_(false) { }
+
+    template <typename Container>
+    indexed_tokenizer(const Container& c, const TokenizerFunc& f)
+      : first_(c.begin()), last_(c.end()), f_(f), indexed_(false) { }
+
+    void assign(Iterator first, Iterator last) {
+      first_ = first;
+      last_ = last;
+      clear_index();
+    }
+
+    void assign(Iterator first, Iterator last, const TokenizerFunc& f) {
+      f_ = f;
+      assign(first, last);
+    }
+
+    template <typename Container>
+    void assign(const Container& c) {
+      assign(c.begin(), c.end());
+    }
+
+    template <typename Container>
+    void assign(const Container& c, const TokenizerFunc& f) {
+      assign(c.begin(), c.end(), f);
+    }
+
+    iterator begin() const { return iterator(this, 0); }
+    iterator end() const { return iterator(this, size()); }
+
+    reverse_iterator rbegin() const { return reverse_iterator(end()); }
+    reverse_iterator rend() const { return reverse_iterator(begin()); }
+
+    size_type size() const {
+      build_index();
+      return index_.size();
+    }
+
+    bool empty() const { return size() == 0; }
+
+    const Type& operator[](size_type i) const {
+      build_index();
+      BOOST_ASSERT(i < index_.size());
+      if (!built_[i]) {
+        TokenizerFunc f(f_);
+        index_[i].state.restore(f);
+        Iterator next = index_[i].pos;
+        f(next, last_, tokens_[i]);
+        built_[i] = true;
+      }
+      return tokens_[i];
+    }
+
+    const Type& at(size_type i) const {
+      if (i >= size())
+        BOOST_THROW_EXCEPTION(std::out_of_range("indexed_tokenizer::at"));
+      return (*this)[i];
+    }
+
+    const Type& front() const { return (*this)[0]; }
+    const Type& back() const { return (*this)[size() - 1]; }
+
+  private:
+    Iterator first_;
+    Iterator last_;
+    TokenizerFunc f_;
+
+    mutable bool indexed_;
+    mutable std::vector<entry> index_;
+    mutable std::vector<Type> tokens_;
+    mutable std::vector<bool> built_;
+
+    void clear_index() {
+      indexed_ = false;
+      index_.clear();
+      tokens_.clear();
+      built_.clear();
+    }
+
+    // Walks the sequence exactly like token_iterator does, but skips the
+    // tokens instead of building them where the TokenizerFunction allows.
+    // The index is built aside, so that if the TokenizerFunction throws
+    // the tokenizer is left unindexed and the next access throws again.
+    void build_index() const {
+      if (indexed_)
+        return;
+      typedef tokenizer_detail::token_skipper<
+        has_token_skip<TokenizerFunc>::value> skipper;
+      TokenizerFunc f(f_);
+      f.reset();
+      std::vector<entry> index;
+      Iterator next = first_;
+      if (next != last_) {
+        Type tok;
+        for (;;) {
+          state_type state(f);
+          Iterator pos = next;
+          if (!skipper::skip(f, next, last_, tok))
+            break;
+          index.push_back(entry(pos, state));
+        }
+      }
+      std::vector<Type> tokens(index.size());
+      std::vector<bool> built(index.size(), false);
+      index_.swap(index);
+      tokens_.swap(tokens);
+      built_.swap(built);
+      indexed_ = true;
+    }
+  };
+
+} // namespace boost
+
+#endif
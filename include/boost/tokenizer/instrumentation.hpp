@@ -0,0 +1,200 @@
+// Boost tokenizer/instrumentation.hpp  -------------------------------------//
+
+// Copyright 2026 Boost.Tokenizer contributors.
+
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// See http://www.boost.org/libs/tokenizer for documentation.
+
+#ifndef BOOST_TOKENIZER_INSTRUMENTATION_HPP_
+#define BOOST_TOKENIZER_INSTRUMENTATION_HPP_
+
+#include <cstddef>
+#include <iterator>
+#include <boost/config.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/token_functions.hpp>
+#include <boost/tokenizer/lenient_escaped_list_separator.hpp>
+#include <boost/tokenizer/separator_spec.hpp>
+
+namespace boost {
+
+  //===========================================================================
+  // Statistics policies for instrumented_separator.
+  //
+  // tokenizer_stats counts what a TokenizerFunction does: the number of
+  // characters it reads, the tokens it produces (and how many of them are
+  // empty), a histogram of token lengths, and the escape sequences and quote
+  // characters it parses; the last two are reported by
+  // escaped_list_separator, lenient_escaped_list_separator and
+  // shared_separator<escaped_list_spec>. null_tokenizer_stats has the same
+  // interface and does nothing; instrumented_separator<F,
+  // null_tokenizer_stats> compiles down to F, so the choice between the two
+  // can be made with a typedef.
+  //
+  // Bucket 0 of the histogram counts empty tokens, bucket i > 0 counts the
+  // tokens whose length is in [2^(i-1), 2^i), and the last bucket also
+  // counts everything longer.
+
+  struct tokenizer_stats {
+    BOOST_STATIC_CONSTANT(bool, enabled = true);
+    BOOST_STATIC_CONSTANT(std::size_t, histogram_size = 16);
+
+    boost::uintmax_t chars_scanned;
+    boost::uintmax_t tokens;
+    boost::uintmax_t empty_tokens;
+    boost::uintmax_t escapes;
+    boost::uintmax_t quotes;
+    boost::uintmax_t length_histogram[histogram_size];
+
+    tokenizer_stats() { reset(); }
+
+    void reset() {
+      chars_scanned = tokens = empty_tokens = escapes = quotes = 0;
+      for (std::size_t i = 0; i < histogram_size; ++i)
+        length_histogram[i] = 0;
+    }
+
+    // Adds the counts of another object, e.g. one per thread.
+    void merge(const tokenizer_stats& other) {
+      chars_scanned += other.chars_scanned;
+      tokens += other.tokens;
+      empty_tokens += other.empty_tokens;
+      escapes += other.escapes;
+      quotes += other.quotes;
+      for (std::size_t i = 0; i < histogram_size; ++i)
+        length_histogram[i] += other.length_histogram[i];
+    }
+
+    static std::size_t bucket(std::size_t length) {
+      std::size_t i = 0;
+      for (; length != 0 && i < histogram_size - 1; length >>= 1)
+        ++i;
+      return i;
+    }
+
+    // The hooks called by instrumented_separator.
+    void scanned(std::size_t n) { chars_scanned += n; }
+    void token(std::size_t length) {
+      ++tokens;
+      if (length == 0)
+        ++empty_tokens;
+      ++length_histogram[bucket(length)];
+    }
+    void escape() { ++escapes; }
+    void quote() { ++quotes; }
+  };
+
+  struct null_tokenizer_stats {
+    BOOST_STATIC_CONSTANT(bool, enabled = false);
+
+    void reset() { }
+    void merge(const null_tokenizer_stats&) { }
+
+    void scanned(std::size_t) { }
+    void token(std::size_t) { }
+    void escape() { }
+    void quote() { }
+  };
+
+  namespace tokenizer_detail {
+
+  // Runs a TokenizerFunction, passing the statistics object on to the
+  // models that report events of their own.
+  template <class TokenizerFunc, class Iterator, class Token, class Stats>
+  bool call_observed(TokenizerFunc& f, Iterator& next, Iterator end,
+                     Token& tok, Stats&) {
+    return f(next, end, tok);
+  }
+
+  template <class Char, class Traits, class Iterator, class Token, class Stats>
+  bool call_observed(escaped_list_separator<Char,Traits>& f, Iterator& next,
+                     Iterator end, Token& tok, Stats& stats) {
+    return f(next, end, tok, stats);
+  }
+
+  template <class Char, class Traits, class Handler, class Iterator,
+            class Token, class Stats>
+  bool call_observed(lenient_escaped_list_separator<Char,Traits,Handler>& f,
+                     Iterator& next, Iterator end, Token& tok,
+                     Stats& stats) {
+    return f(next, end, tok, stats);
+  }
+
+  template <class Char, class Traits, class Iterator, class Token,
+            class Stats>
+  bool call_observed(shared_separator<escaped_list_spec<Char,Traits> >& f,
+                     Iterator& next, Iterator end, Token& tok,
+                     Stats& stats) {
+    return f(next, end, tok, stats);
+  }
+
+  // The number of characters between two positions; characters read
+  // through an input iterator cannot be counted afterwards.
+  template <class Iterator>
+  std::size_t scanned_distance(Iterator first, Iterator last,
+                               std::forward_iterator_tag) {
+    return static_cast<std::size_t>(std::distance(first, last));
+  }
+
+  template <class Iterator>
+  std::size_t scanned_distance(Iterator, Iterator, std::input_iterator_tag) {
+    return 0;
+  }
+
+  } // namespace tokenizer_detail
+
+
+  //===========================================================================
+  // The instrumented_separator class is a model of TokenizerFunction that
+  // wraps another one and reports what it does to a Stats object. Copies of
+  // the separator, such as those held by token iterators, all report to the
+  // same Stats object, which must outlive them; use one object per thread
+  // and merge them afterwards.
+  //
+  // Token lengths are taken from Type::size(). The number of characters
+  // scanned is only known for forward iterators.
+
+  template <class TokenizerFunc, class Stats = tokenizer_stats>
+  class instrumented_separator {
+  public:
+    instrumented_separator() : f_(), stats_(0) { }
+
+    explicit instrumented_separator(Stats& stats,
+                                    const TokenizerFunc& f = TokenizerFunc())
+      : f_(f), stats_(&stats) { }
+
+    void reset() { f_.reset(); }
+
+    template <typename InputIterator, typename Token>
+    bool operator()(InputIterator& next, InputIterator end, Token& tok)
+    {
+      if (!Stats::enabled || !stats_)
+        return f_(next, end, tok);
+
+      typedef BOOST_DEDUCED_TYPENAME tokenizer_detail::get_iterator_category<
+        InputIterator
+      >::iterator_category category;
+
+      InputIterator start(next);
+      bool found = tokenizer_detail::call_observed(f_, next, end, tok, *stats_);
+      stats_->scanned(tokenizer_detail::scanned_distance(start, next,
+                                                         category()));
+      if (found)
+        stats_->token(tok.size());
+      return found;
+    }
+
+    const TokenizerFunc& tokenizer_function() const { return f_; }
+    Stats* stats() const { return stats_; }
+
+  private:
+    TokenizerFunc f_;
+    Stats* stats_;
+  };
+
+} // namespace boost
+
+#endif
@@ -0,0 +1,158 @@
+// Boost tokenizer/lenient_escaped_list_separator.hpp  ----------------------//
+
+// Copyright 2026 Boost.Tokenizer contributors.
+
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// See http://www.boost.org/libs/tokenizer for documentation.
+
+#ifndef BOOST_TOKENIZER_LENIENT_ESCAPED_LIST_SEPARATOR_HPP_
+#define BOOST_TOKENIZER_LENIENT_ESCAPED_LIST_SEPARATOR_HPP_
+
+#include <cstddef>
+#include <iterator>
+#include <string>
+#include <boost/token_functions.hpp>
+#include <boost/type_traits/integral_constant.hpp>
+
+namespace boost {
+
+  // What lenient_escaped_list_separator puts in the token for a bad
+  // escape sequence.
+  enum bad_escape_policy {
+    skip_bad_escapes,   // nothing
+    keep_bad_escapes    // the sequence as it was written
+  };
+
+  namespace tokenizer_detail {
+    // The default error handler, which only lets the separator record the
+    // first error of each field.
+    struct ignore_escape_errors {
+      void operator()(escaped_list_errc, std::size_t) const { }
+    };
+  }
+
+
+  //===========================================================================
+  // The lenient_escaped_list_separator class is a model of
+  // TokenizerFunction that splits fields as escaped_list_separator does,
+  // but does not throw on bad escape sequences. The sequence is dropped or
+  // kept as written, as the bad_escape_policy says, and parsing goes on
+  // with the next character, so that a malformed row costs no more than a
+  // well formed one.
+  //
+  // After each field, error() is the first error found in it, or
+  // no_escape_error, and error_offset() the offset of its escape character
+  // from the start of the input. Every error is also passed to the
+  // ErrorHandler, called as handler(code, offset). Offsets are counted in
+  // characters since the last reset(), which the token iterators call at
+  // the start of each input. Requires forward iterators.
+
+  template <class Char,
+    class Traits = BOOST_DEDUCED_TYPENAME std::basic_string<Char>::traits_type,
+    class ErrorHandler = tokenizer_detail::ignore_escape_errors>
+  class lenient_escaped_list_separator {
+    typedef escaped_list_separator<Char,Traits> separator;
+    typedef std::basic_string<Char,Traits> string_type;
+  public:
+    explicit lenient_escaped_list_separator(
+        Char e = '\\', Char c = ',', Char q = '\"',
+        bad_escape_policy policy = keep_bad_escapes,
+        const ErrorHandler& handler = ErrorHandler())
+      : sep_(e, c, q), policy_(policy), handler_(handler) { reset(); }
+
+    lenient_escaped_list_separator(
+        string_type e, string_type c, string_type q,
+        bad_escape_policy policy = keep_bad_escapes,
+        const ErrorHandler& handler = ErrorHandler())
+      : sep_(e, c, q), policy_(policy), handler_(handler) { reset(); }
+
+    void reset() {
+      last_ = false;
+      offset_ = 0;
+      field_offset_ = 0;
+      error_ = no_escape_error;
+      error_offset_ = 0;
+    }
+
+    template <typename Iterator, typename Token>
+    bool operator()(Iterator& next, Iterator end, Token& tok) {
+      tokenizer_detail::null_observer obs;
+      return (*this)(next, end, tok, obs);
+    }
+
+    // Same as above, and also tells obs about every escape sequence and
+    // quote character it parses, as escaped_list_separator does.
+    template <typename Iterator, typename Token, typename Observer>
+    bool operator()(Iterator& next, Iterator end, Token& tok,
+                    Observer& obs) {
+      field_offset_ = offset_;
+      error_ = no_escape_error;
+      error_offset_ = 0;
+      Iterator start(next);
+      error_sink<Iterator> errors(*this, start);
+      bool found = separator::scan(sep_, last_, next, end, tok, obs, errors);
+      offset_ += static_cast<std::size_t>(std::distance(start, next));
+      return found;
+    }
+
+    // Like operator(), but only finds the end of the token.
+    template <typename Iterator>
+    bool skip(Iterator& next, Iterator end) {
+      tokenizer_detail::discard_token tok;
+      return (*this)(next, end, tok);
+    }
+
+    escaped_list_errc error() const { return error_; }
+    std::size_t error_offset() const { return error_offset_; }
+
+    // The offset of the last field from the start of the input.
+    std::size_t field_offset() const { return field_offset_; }
+
+    const ErrorHandler& handler() const { return handler_; }
+
+  private:
+    template <typename Iterator>
+    struct error_sink {
+      error_sink(lenient_escaped_list_separator& sep, Iterator start)
+        : sep_(sep), start_(start) { }
+
+      template <typename Token>
+      void bad_escape(escaped_list_errc code, Iterator first, Iterator last,
+                      Token& tok) {
+        std::size_t offset = sep_.field_offset_ +
+          static_cast<std::size_t>(std::distance(start_, first));
+        if (sep_.error_ == no_escape_error) {
+          sep_.error_ = code;
+          sep_.error_offset_ = offset;
+        }
+        sep_.handler_(code, offset);
+        if (sep_.policy_ == keep_bad_escapes)
+          for (; first != last; ++first)
+            tok += *first;
+      }
+
+      lenient_escaped_list_separator& sep_;
+      Iterator start_;
+    };
+
+    separator sep_;
+    bad_escape_policy policy_;
+    ErrorHandler handler_;
+    bool last_;
+    std::size_t offset_;
+    std::size_t field_offset_;
+    escaped_list_errc error_;
+    std::size_t error_offset_;
+  };
+
+  template <class Char, class Traits, class ErrorHandler>
+  struct has_token_skip<
+    lenient_escaped_list_separator<Char,Traits,ErrorHandler>
+  > : public true_type { };
+
+} // namespace boost
+
+#endif
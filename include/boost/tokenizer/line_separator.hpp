@@ -0,0 +1,172 @@
+// Boost tokenizer/line_separator.hpp  --------------------------------------//
+
+// Copyright 2026 Boost.Tokenizer contributors.
+
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// See http://www.boost.org/libs/tokenizer for documentation.
+
+#ifndef BOOST_TOKENIZER_LINE_SEPARATOR_HPP_
+#define BOOST_TOKENIZER_LINE_SEPARATOR_HPP_
+
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <boost/throw_exception.hpp>
+#include <boost/token_functions.hpp>
+#include <boost/tokenizer/detail/contiguous_iterator.hpp>
+#include <boost/type_traits/integral_constant.hpp>
+
+namespace boost {
+
+  struct line_length_error : public std::runtime_error {
+    line_length_error(const std::string& what_arg)
+      : std::runtime_error(what_arg) { }
+  };
+
+
+  //===========================================================================
+  // The line_separator class is a model of TokenizerFunction that splits
+  // text into lines. A line ends at a newline or at the end of the input; a
+  // newline at the very end does not start another, empty, line.
+  //
+  // With strip_cr, a carriage return at the end of a line is removed, so
+  // that files with CRLF line endings give the same lines as those with LF
+  // endings. Empty lines are returned unless empty_lines is
+  // drop_empty_tokens. If max_length is not 0, a line longer than that
+  // throws line_length_error as soon as it is seen to be too long; the
+  // carriage return that is stripped does not count.
+  //
+  // For pointers to Char and the iterators of std::basic_string and
+  // std::vector of Char,
+  // the newline is found with Traits::find, which for char is memchr;
+  // other iterators are read one character at a time.
+
+  template <class Char,
+    class Tr = BOOST_DEDUCED_TYPENAME std::basic_string<Char>::traits_type >
+  class line_separator {
+  public:
+    explicit line_separator(empty_token_policy empty_lines = keep_empty_tokens,
+                            bool strip_cr = true,
+                            std::size_t max_length = 0)
+      : m_empty_lines(empty_lines), m_strip_cr(strip_cr),
+        m_max_length(max_length) { }
+
+    void reset() { }
+
+    template <typename InputIterator, typename Token>
+    bool operator()(InputIterator& next, InputIterator end, Token& tok)
+    {
+      typedef BOOST_DEDUCED_TYPENAME tokenizer_detail::get_iterator_category<
+        InputIterator
+      >::iterator_category category;
+      typedef tokenizer_detail::is_contiguous_iterator<
+        InputIterator, Char
+      > contiguous;
+
+      for (;;) {
+        if (next == end)
+          return false;
+        std::size_t length = find_line(next, end, tok, category(),
+                                       contiguous());
+        if (length != 0 || m_empty_lines == keep_empty_tokens)
+          return true;
+      }
+    }
+
+    // Like operator(), but only finds the end of the token.
+    template <typename InputIterator>
+    bool skip(InputIterator& next, InputIterator end) {
+      tokenizer_detail::discard_token tok;
+      return (*this)(next, end, tok);
+    }
+
+  private:
+    static Char newline() { return Tr::to_char_type('\n'); }
+    static Char cr() { return Tr::to_char_type('\r'); }
+
+    void check_length(std::size_t length) const {
+      if (m_max_length != 0 && length > m_max_length)
+        BOOST_THROW_EXCEPTION(line_length_error(std::string("line too long")));
+    }
+
+    // The line found by searching contiguous characters: next is advanced
+    // past the newline, and the length of the line is returned.
+    template <typename Iterator, typename Token>
+    std::size_t find_line(Iterator& next, Iterator end, Token& tok,
+                          std::random_access_iterator_tag, true_type) const
+    {
+      const Char* first = &*next;
+      std::size_t n = static_cast<std::size_t>(end - next);
+      const Char* nl = Tr::find(first, n, newline());
+      std::size_t length = nl ? static_cast<std::size_t>(nl - first) : n;
+      std::size_t consumed = nl ? length + 1 : length;
+      if (m_strip_cr && length != 0 && Tr::eq(first[length - 1], cr()))
+        --length;
+      check_length(length);
+
+      Iterator start(next);
+      tok.assign(start, start + length);
+      next += consumed;
+      return length;
+    }
+
+    // Any other iterator is read a character at a time. A carriage return
+    // is only added to the token once another character follows it.
+    template <typename InputIterator, typename Token, typename Category>
+    std::size_t find_line(InputIterator& next, InputIterator end, Token& tok,
+                          Category, false_type) const
+    {
+      typedef tokenizer_detail::assign_or_plus_equal<Category> assigner;
+
+      assigner::clear(tok);
+      InputIterator start(next);
+      InputIterator stop(next);
+      std::size_t length = 0;
+      bool pending_cr = false;
+      for (; next != end; ++next) {
+        Char c = *next;
+        if (Tr::eq(c, newline()))
+          break;
+        if (pending_cr) {
+          assigner::plus_equal(tok, cr());
+          check_length(++length);
+          pending_cr = false;
+        }
+        if (m_strip_cr && Tr::eq(c, cr())) {
+          pending_cr = true;
+          stop = next;
+          continue;
+        }
+        assigner::plus_equal(tok, c);
+        check_length(++length);
+      }
+      if (!pending_cr)
+        stop = next;
+      assigner::assign(start, stop, tok);
+      if (next != end)
+        ++next;
+      return length;
+    }
+
+    // An iterator category derived from random access is read the same way.
+    template <typename Iterator, typename Token, typename Category>
+    std::size_t find_line(Iterator& next, Iterator end, Token& tok,
+                          Category category, true_type) const
+    {
+      return find_line(next, end, tok, category, false_type());
+    }
+
+    empty_token_policy m_empty_lines;
+    bool m_strip_cr;
+    std::size_t m_max_length;
+  };
+
+  template <class Char, class Tr>
+  struct has_token_skip<line_separator<Char,Tr> > : public true_type { };
+
+} // namespace boost
+
+#endif
@@ -0,0 +1,122 @@
+// Boost tokenizer/located_token.hpp  ---------------------------------------//
+
+// Copyright 2026 Boost.Tokenizer contributors.
+
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// See http://www.boost.org/libs/tokenizer for documentation.
+
+#ifndef BOOST_TOKENIZER_LOCATED_TOKEN_HPP_
+#define BOOST_TOKENIZER_LOCATED_TOKEN_HPP_
+
+#include <cstddef>
+#include <iterator>
+#include <string>
+#include <utility>
+#include <boost/config.hpp>
+#include <boost/token_functions.hpp>
+
+namespace boost {
+
+  //===========================================================================
+  // A located_token is a token type that holds the token, as a Type, along
+  // with the part of the input that it was found in, so that the position
+  // of a token is known without searching for it again:
+  //
+  //   typedef std::string::const_iterator iter;
+  //   tokenizer<escaped_list_separator<char>, iter, located_token<iter> >
+  //     tok(line);
+  //   for (...; ++it)
+  //     report(it->value(), it->offsets(line.begin()));
+  //
+  // The part of the input is the one the separator read for the token,
+  // without the delimiters around it; for escaped_list_separator it keeps
+  // the quotes and escapes that the token itself has lost. Separators that
+  // build their tokens with assign(first, last) give the range there, and
+  // the ones that build them with += report it through
+  // tokenizer_detail::token_location_traits, so finding it costs no extra
+  // scan. Requires forward iterators.
+
+  template <class Iterator,
+    class Type = std::basic_string<
+      BOOST_DEDUCED_TYPENAME std::iterator_traits<Iterator>::value_type> >
+  class located_token {
+  public:
+    typedef Iterator iterator;
+    typedef Type value_type;
+    typedef std::size_t size_type;
+
+    located_token() : value_(), first_(), last_() { }
+    located_token(const Type& value, Iterator first, Iterator last)
+      : value_(value), first_(first), last_(last) { }
+
+    void assign(Iterator first, Iterator last) {
+      value_.assign(first, last);
+      first_ = first;
+      last_ = last;
+    }
+
+    template <class Char>
+    located_token& operator+=(const Char& c) {
+      value_ += c;
+      return *this;
+    }
+
+    void locate(Iterator first, Iterator last) {
+      first_ = first;
+      last_ = last;
+    }
+
+    const Type& value() const { return value_; }
+
+    // The part of the input the token was found in.
+    Iterator source_begin() const { return first_; }
+    Iterator source_end() const { return last_; }
+
+    // The offsets of source_begin() and source_end() from origin, usually
+    // the start of the input.
+    std::pair<size_type,size_type> offsets(Iterator origin) const {
+      return std::make_pair(
+        static_cast<size_type>(std::distance(origin, first_)),
+        static_cast<size_type>(std::distance(origin, last_)));
+    }
+
+  private:
+    Type value_;
+    Iterator first_;
+    Iterator last_;
+  };
+
+  template <class Iterator, class Type>
+  bool operator==(const located_token<Iterator,Type>& a,
+                  const located_token<Iterator,Type>& b)
+  {
+    return a.value() == b.value() &&
+      a.source_begin() == b.source_begin() &&
+      a.source_end() == b.source_end();
+  }
+
+  template <class Iterator, class Type>
+  bool operator!=(const located_token<Iterator,Type>& a,
+                  const located_token<Iterator,Type>& b)
+  {
+    return !(a == b);
+  }
+
+  namespace tokenizer_detail {
+
+  template <class Iterator, class Type>
+  struct token_location_traits<located_token<Iterator,Type> > {
+    static void set(located_token<Iterator,Type>& tok, Iterator first,
+                    Iterator last) {
+      tok.locate(first, last);
+    }
+  };
+
+  } // namespace tokenizer_detail
+
+} // namespace boost
+
+#endif
@@ -0,0 +1,348 @@
+// Boost tokenizer/parallel_tokenize.hpp  -----------------------------------//
+
+// Copyright 2026 Boost.Tokenizer contributors.
+
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// See http://www.boost.org/libs/tokenizer for documentation.
+
+#ifndef BOOST_TOKENIZER_PARALLEL_TOKENIZE_HPP_
+#define BOOST_TOKENIZER_PARALLEL_TOKENIZE_HPP_
+
+#include <boost/config.hpp>
+
+#if !defined(BOOST_NO_CXX11_HDR_THREAD) && \
+    !defined(BOOST_NO_CXX11_HDR_MUTEX) && \
+    !defined(BOOST_NO_CXX11_HDR_ATOMIC) && \
+    !defined(BOOST_NO_CXX11_HDR_CONDITION_VARIABLE) && \
+    !defined(BOOST_NO_CXX11_HDR_EXCEPTION) && \
+    !defined(BOOST_NO_CXX11_LAMBDAS)
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+#include <boost/tokenizer/token_batch.hpp>
+
+namespace boost {
+
+  enum parallel_output { unordered_output, ordered_output };
+
+  //===========================================================================
+  // The tokens of one document, as parallel_tokenize passes them to its
+  // sink. They are held in a token_batch owned by a worker, and are only
+  // valid during the call to the sink.
+
+  template <class Char = char,
+    class Tr = typename std::basic_string<Char>::traits_type >
+  class document_tokens {
+  public:
+    typedef token_batch<Char,Tr> batch_type;
+    typedef typename batch_type::string_type string_type;
+    typedef std::size_t size_type;
+
+    document_tokens(size_type document, const batch_type& batch,
+                    size_type input)
+      : document_(document), batch_(&batch),
+        tokens_(batch.tokens_of(input)) { }
+
+    // The index of the document in the input.
+    size_type document() const { return document_; }
+
+    size_type size() const { return tokens_.second - tokens_.first; }
+    bool empty() const { return size() == 0; }
+
+    const Char* token_data(size_type i) const {
+      return batch_->token_data(tokens_.first + i);
+    }
+    size_type token_size(size_type i) const {
+      return batch_->token_size(tokens_.first + i);
+    }
+    string_type token(size_type i) const {
+      return batch_->token(tokens_.first + i);
+    }
+
+    const batch_type& batch() const { return *batch_; }
+
+  private:
+    size_type document_;
+    const batch_type* batch_;
+    std::pair<size_type,size_type> tokens_;
+  };
+
+  namespace tokenizer_detail {
+
+  // The documents a worker has yet to tokenize, [next, end). The owner
+  // takes them from the front, and idle workers steal the back half.
+  struct work_range {
+    work_range() : next(0), end(0) { }
+
+    std::mutex lock;
+    std::size_t next;
+    std::size_t end;
+  };
+
+  class work_stealing_queues {
+  public:
+    work_stealing_queues(std::size_t documents, std::size_t workers)
+      : ranges_(new work_range[workers]), workers_(workers)
+    {
+      for (std::size_t w = 0; w < workers; ++w) {
+        ranges_[w].next = documents * w / workers;
+        ranges_[w].end = documents * (w + 1) / workers;
+      }
+    }
+
+    // The next document for worker w, from its own range or else from
+    // the largest part of another's. False when no work is left anywhere,
+    // since documents are only ever handed out, never added.
+    bool pop(std::size_t w, std::size_t& document) {
+      {
+        std::lock_guard<std::mutex> own(ranges_[w].lock);
+        if (ranges_[w].next != ranges_[w].end) {
+          document = ranges_[w].next++;
+          return true;
+        }
+      }
+      for (std::size_t k = 1; k < workers_; ++k) {
+        work_range& victim = ranges_[(w + k) % workers_];
+        std::size_t first, last;
+        {
+          std::lock_guard<std::mutex> guard(victim.lock);
+          std::size_t left = victim.end - victim.next;
+          if (left == 0)
+            continue;
+          last = victim.end;
+          first = victim.end - (left + 1) / 2;
+          victim.end = first;
+        }
+        document = first;
+        std::lock_guard<std::mutex> own(ranges_[w].lock);
+        ranges_[w].next = first + 1;
+        ranges_[w].end = last;
+        return true;
+      }
+      return false;
+    }
+
+  private:
+    std::unique_ptr<work_range[]> ranges_;
+    std::size_t workers_;
+  };
+
+  // The state shared by the workers and the calling thread of one call to
+  // parallel_tokenize: whether to stop, the first exception, and, for
+  // ordered output, the documents that are done but not yet passed to the
+  // sink. Those are kept in a ring of window batches, slot d % window for
+  // document d, so that workers never get more than window documents ahead
+  // of the sink and memory stays bounded whatever the number of documents.
+  template <class Batch>
+  class parallel_state {
+  public:
+    parallel_state(std::size_t window)
+      : failed_(false), emitted_(0), window_(window),
+        slots_(window), done_(window, false) { }
+
+    bool failed() const { return failed_.load(std::memory_order_relaxed); }
+
+    // Records the exception being handled, if it is the first, and wakes
+    // everyone up so that they stop.
+    void fail() {
+      {
+        std::lock_guard<std::mutex> guard(lock_);
+        if (!error_)
+          error_ = std::current_exception();
+        failed_.store(true);
+      }
+      changed_.notify_all();
+    }
+
+    void rethrow_if_failed() const {
+      if (error_)
+        std::rethrow_exception(error_);
+    }
+
+    // Waits until document d has a free slot, and returns it; 0 if the
+    // work has failed.
+    Batch* acquire(std::size_t d) {
+      std::unique_lock<std::mutex> guard(lock_);
+      while (d >= emitted_ + window_ && !failed())
+        changed_.wait(guard);
+      return failed() ? 0 : &slots_[d % window_];
+    }
+
+    void done(std::size_t d) {
+      {
+        std::lock_guard<std::mutex> guard(lock_);
+        done_[d % window_] = true;
+      }
+      changed_.notify_all();
+    }
+
+    // Waits until document d is done, and returns it; 0 if the work has
+    // failed.
+    Batch* wait_for(std::size_t d) {
+      std::unique_lock<std::mutex> guard(lock_);
+      while (!done_[d % window_] && !failed())
+        changed_.wait(guard);
+      return failed() ? 0 : &slots_[d % window_];
+    }
+
+    // Frees the slot of document d, once the sink has had it.
+    void release(std::size_t d) {
+      slots_[d % window_].clear();
+      {
+        std::lock_guard<std::mutex> guard(lock_);
+        done_[d % window_] = false;
+        ++emitted_;
+      }
+      changed_.notify_all();
+    }
+
+  private:
+    std::atomic<bool> failed_;
+    std::exception_ptr error_;
+    std::mutex lock_;
+    std::condition_variable changed_;
+    std::size_t emitted_;
+    std::size_t window_;
+    std::vector<Batch> slots_;
+    std::vector<bool> done_;
+  };
+
+  } // namespace tokenizer_detail
+
+
+  //===========================================================================
+  // parallel_tokenize tokenizes each of a random access sequence of
+  // documents, such as a std::vector<std::string>, on several threads, and
+  // passes the tokens of each to sink as a document_tokens. The tokens of a
+  // document are those of a tokenizer over it.
+  //
+  // Each worker thread has its own copy of the TokenizerFunction, and the
+  // tokens are built in token_batch arenas that grow to fit the largest
+  // documents and are then reused, so that tokens are not allocated one by
+  // one.
+  //
+  // With unordered_output, the sink is called by the workers as soon as a
+  // document is done, in any order and concurrently, so it must be thread
+  // safe. The documents are first split evenly between the workers, the
+  // calling thread being one of them; a worker that runs out steals the
+  // back half of the documents that another has left, so that uneven
+  // document sizes do not leave threads idle.
+  //
+  // With ordered_output, the workers take the documents in order, and the
+  // calling thread passes each one to the sink as soon as it and all those
+  // before it are done. At most 4 documents per worker are held waiting
+  // for the sink; a worker that gets that far ahead waits for it.
+  //
+  // threads == 0 means std::thread::hardware_concurrency(). If the
+  // TokenizerFunction or the sink throws, or a thread cannot be started,
+  // the workers stop after their current document, all of them are
+  // joined, and the first exception is rethrown.
+
+  template <class Documents, class TokenizerFunc, class Sink>
+  void parallel_tokenize(const Documents& documents, const TokenizerFunc& f,
+                         Sink sink, parallel_output output = unordered_output,
+                         std::size_t threads = 0)
+  {
+    typedef typename Documents::value_type document_type;
+    typedef typename document_type::value_type char_type;
+    typedef token_batch<char_type> batch_type;
+    typedef document_tokens<char_type> tokens_type;
+
+    const std::size_t n = documents.size();
+    if (threads == 0)
+      threads = std::thread::hardware_concurrency();
+    if (threads == 0)
+      threads = 1;
+    if (threads > n)
+      threads = n == 0 ? 1 : n;
+
+    const bool ordered = output == ordered_output;
+    tokenizer_detail::parallel_state<batch_type> state(
+      ordered ? 4 * threads : 0);
+
+    // Unordered output: work stealing, and an arena per worker.
+    tokenizer_detail::work_stealing_queues queues(ordered ? 0 : n, threads);
+    std::vector<batch_type> arenas(ordered ? 0 : threads);
+
+    // Ordered output: the documents are handed out in order.
+    std::atomic<std::size_t> next_document(0);
+
+    auto work = [&](std::size_t w) {
+      try {
+        TokenizerFunc sep(f);
+        if (ordered) {
+          for (;;) {
+            std::size_t d = next_document.fetch_add(1);
+            if (d >= n || state.failed())
+              break;
+            batch_type* slot = state.acquire(d);
+            if (!slot)
+              break;
+            append_tokens(sep, documents[d].begin(), documents[d].end(),
+                          *slot);
+            state.done(d);
+          }
+        }
+        else {
+          batch_type& arena = arenas[w];
+          std::size_t d;
+          while (!state.failed() && queues.pop(w, d)) {
+            append_tokens(sep, documents[d].begin(), documents[d].end(),
+                          arena);
+            sink(tokens_type(d, arena, 0));
+            arena.clear();
+          }
+        }
+      }
+      catch (...) {
+        state.fail();
+      }
+    };
+
+    // In ordered mode the calling thread feeds the sink, and all the
+    // workers are started threads.
+    const std::size_t first = ordered ? 0 : 1;
+    std::vector<std::thread> workers;
+    try {
+      workers.reserve(threads - first);
+      for (std::size_t w = first; w < threads; ++w)
+        workers.push_back(std::thread(work, w));
+      if (ordered) {
+        for (std::size_t d = 0; d < n; ++d) {
+          batch_type* slot = state.wait_for(d);
+          if (!slot)
+            break;
+          sink(tokens_type(d, *slot, 0));
+          state.release(d);
+        }
+      }
+      else
+        work(0);
+    }
+    catch (...) {
+      state.fail();
+      for (std::size_t w = 0; w < workers.size(); ++w)
+        workers[w].join();
+      throw;
+    }
+    for (std::size_t w = 0; w < workers.size(); ++w)
+      workers[w].join();
+    state.rethrow_if_failed();
+  }
+
+} // namespace boost
+
+#endif
+
+#endif
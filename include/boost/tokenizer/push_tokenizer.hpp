@@ -0,0 +1,528 @@
+// Boost tokenizer/push_tokenizer.hpp  --------------------------------------//
+
+// Copyright 2026 Boost.Tokenizer contributors.
+
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// See http://www.boost.org/libs/tokenizer for documentation.
+
+#ifndef BOOST_TOKENIZER_PUSH_TOKENIZER_HPP_
+#define BOOST_TOKENIZER_PUSH_TOKENIZER_HPP_
+
+#include <cstddef>
+#include <iterator>
+#include <string>
+#include <boost/config.hpp>
+#include <boost/token_functions.hpp>
+
+namespace boost {
+
+  namespace tokenizer_detail {
+
+  template <class TokenizerFunc>
+  TokenizerFunc reset_function(const TokenizerFunc& f) {
+    TokenizerFunc g(f);
+    g.reset();
+    return g;
+  }
+
+  } // namespace tokenizer_detail
+
+
+  //===========================================================================
+  // The push_state class holds everything a TokenizerFunction needs to
+  // remember between two buffers when it is driven in push mode: the
+  // state of the function between two tokens, as separator_state saves it,
+  // and the token that the end of the last buffer has cut in two, if any.
+  // The separator is put back in that state before each push, so a single
+  // separator can serve any number of states, e.g. one per connection.
+  //
+  // For a function with a push member (see has_token_push), the cut token
+  // is kept as the characters it has so far, in pending, and where the
+  // parse of the function stands inside it, in resume: whether it is
+  // between quotes or after an escape character, or how many characters
+  // of an offset it has. A character that the end of a buffer cuts in two,
+  // for the functions that read several characters at a time such as
+  // utf8_separator, is kept in split. For other functions pending holds
+  // the input of the token, which is scanned again with the next buffer,
+  // and split the input the last token was found in.
+  //
+  // push_state is an ordinary value: it can be copied to take a snapshot of
+  // the parse and assigned to go back to one.
+
+  template <class TokenizerFunc, class Char = char>
+  struct push_state {
+    typedef tokenizer_detail::separator_state<TokenizerFunc> separator_type;
+
+    explicit push_state(const TokenizerFunc& f)
+      : separator(tokenizer_detail::reset_function(f)), pending(), split(),
+        resume(), seen_input(false), done(false) { }
+
+    // The state of the separator after the last complete token.
+    separator_type separator;
+    // The token cut by the end of the last buffer, as described above.
+    std::basic_string<Char> pending;
+    std::basic_string<Char> split;
+    tokenizer_detail::scan_resume resume;
+    // At least one character has been pushed; an empty input has no tokens.
+    bool seen_input;
+    // The separator has returned its last token.
+    bool done;
+  };
+
+  namespace tokenizer_detail {
+
+  enum push_result {
+    push_found,     // a token is complete
+    push_finished,  // the separator has no more tokens
+    push_more,      // the input ends inside a token, or between two
+    push_split,     // as push_more, and [next, last) is a character cut in two
+    push_skipped    // as push_more, but the input read holds no token
+  };
+
+  // The input of a push member: a buffer, which more input may follow, and
+  // the place in a push_state where the parse of a token cut by its end is
+  // kept. See tokenizer_detail::input_ends.
+  class push_input {
+  public:
+    push_input(scan_resume& resume, bool more)
+      : resume_(resume), more_(more), split_(false) { }
+
+    bool more() const { return more_; }
+    bool in_token() const { return resume_.in_token; }
+    bool in_quote() const { return resume_.in_quote; }
+    bool escape() const { return resume_.escape; }
+    unsigned taken() const { return resume_.taken; }
+
+    void cut_token() { resume_.in_token = true; }
+    void cut_field(bool in_quote, bool escape) {
+      resume_.in_token = true;
+      resume_.in_quote = in_quote;
+      resume_.escape = escape;
+    }
+    void cut_offset(unsigned taken) {
+      resume_.in_token = true;
+      resume_.taken = taken;
+    }
+    void cut_character() { split_ = true; }
+
+    bool split() const { return split_; }
+
+  private:
+    scan_resume& resume_;
+    bool more_;
+    bool split_;
+  };
+
+  // The token a push member builds. A token that lies in one buffer is
+  // assigned to the caller's token from the buffer; the characters of one
+  // that goes on from the last buffer, or that the separator builds a
+  // character at a time, are collected in pending, and the caller's token
+  // is assigned from there.
+  template <class Type, class Char, class Iterator>
+  class pushed_token {
+  public:
+    pushed_token(Type& tok, std::basic_string<Char>& pending, bool copy)
+      : tok_(tok), pending_(pending), first_(), last_(), ranged_(false),
+        copy_(copy) { }
+
+    void assign(Iterator first, Iterator last) {
+      first_ = first;
+      last_ = last;
+      ranged_ = true;
+    }
+
+    template <class Value>
+    pushed_token& operator+=(const Value& c) {
+      pending_ += c;
+      return *this;
+    }
+
+    void clear() { ranged_ = false; }
+
+    Type& token() { return tok_; }
+
+    // Keeps the part of a token that the end of the buffer has cut.
+    void keep() {
+      if (ranged_)
+        pending_.append(first_, last_);
+      ranged_ = false;
+    }
+
+    // Stores the complete token in the caller's token.
+    void give() {
+      if (pending_.empty() && !copy_) {
+        if (ranged_)
+          tok_.assign(first_, last_);
+        else
+          token_clear_traits<Type>::clear(tok_);
+        return;
+      }
+      keep();
+      tok_.assign(pending_.data(), pending_.data() + pending_.size());
+    }
+
+  private:
+    Type& tok_;
+    std::basic_string<Char>& pending_;
+    Iterator first_;
+    Iterator last_;
+    bool ranged_;
+    bool copy_;
+  };
+
+  template <class Type, class Char, class Iterator>
+  struct token_clear_traits<pushed_token<Type,Char,Iterator> > {
+    static void clear(pushed_token<Type,Char,Iterator>& t) { t.clear(); }
+  };
+
+  template <class Type, class Char, class Iterator>
+  struct token_kind_traits<pushed_token<Type,Char,Iterator> > {
+    static void set(pushed_token<Type,Char,Iterator>& t, token_kind kind) {
+      token_kind_traits<Type>::set(t.token(), kind);
+    }
+  };
+
+  // Runs f over [next, last) from the state saved in state. Unless the
+  // input ends at last, the parse of a token that reaches last is saved in
+  // state, to go on with the next buffer. With copy, the token is stored
+  // from pending even if it lies in [next, last).
+  template <class TokenizerFunc, class Char, class Iterator, class Type>
+  push_result push_scan(TokenizerFunc& f,
+                        push_state<TokenizerFunc,Char>& state,
+                        Iterator& next, Iterator last, bool eof, Type& tok,
+                        bool copy, const true_type&)
+  {
+    state.separator.restore(f);
+    // The last token returned may still be read from pending.
+    if (!state.resume.in_token)
+      state.pending.clear();
+    push_input in(state.resume, !eof);
+    pushed_token<Type,Char,Iterator> t(tok, state.pending, copy);
+    if (f.push(next, last, t, in)) {
+      state.separator = separator_state<TokenizerFunc>(f);
+      state.resume = scan_resume();
+      t.give();
+      return push_found;
+    }
+    if (!eof && (next == last || in.split())) {
+      state.separator = separator_state<TokenizerFunc>(f);
+      t.keep();
+      return in.split() ? push_split : push_more;
+    }
+    return push_finished;
+  }
+
+  // The same for a function without a push member: it runs over the input
+  // as a tokenizer would, and a token that reaches last may go on past it.
+  // Then nothing is saved, and the caller keeps the input to scan it
+  // again with more. When f resumes at a token (see separator_state), a
+  // scan that found no token only passed over delimiters, which need not
+  // be kept.
+  template <class TokenizerFunc, class Char, class Iterator, class Type>
+  push_result push_scan(TokenizerFunc& f,
+                        push_state<TokenizerFunc,Char>& state,
+                        Iterator& next, Iterator last, bool eof, Type& tok,
+                        bool, const false_type&)
+  {
+    state.separator.restore(f);
+    bool found = f(next, last, tok);
+    if (!eof && next == last) {
+      if (!found && separator_state<TokenizerFunc>::resumes_at_token(f))
+        return push_skipped;
+      return push_more;
+    }
+    if (!found)
+      return push_finished;
+    state.separator = separator_state<TokenizerFunc>(f);
+    return push_found;
+  }
+
+  template <class TokenizerFunc, class Char, class Iterator, class Type>
+  push_result push_scan(TokenizerFunc& f,
+                        push_state<TokenizerFunc,Char>& state,
+                        Iterator& next, Iterator last, bool eof, Type& tok,
+                        bool copy = false)
+  {
+    return push_scan(f, state, next, last, eof, tok, copy,
+                     has_token_push<TokenizerFunc>());
+  }
+
+  // push_token for a function with a push member: the token is found in
+  // the buffer, going on from the parse saved in state, so that every
+  // character is read once.
+  template <class TokenizerFunc, class Char, class Iterator, class Type>
+  bool push_buffer(TokenizerFunc& f, push_state<TokenizerFunc,Char>& state,
+                   Iterator& next, Iterator end, Type& tok, const true_type&)
+  {
+    while (next != end) {
+      if (state.split.empty()) {
+        switch (push_scan(f, state, next, end, false, tok)) {
+        case push_found:
+          return true;
+        case push_finished:
+          state.done = true;
+          break;
+        case push_split:
+          state.split.assign(next, end);
+          break;
+        default:
+          break;
+        }
+        next = end;
+        return false;
+      }
+
+      // The last buffer ended with a character cut in two. It is scanned
+      // together with the first few characters of this buffer, enough to
+      // complete it, and the token is stored from pending.
+      std::size_t kept = state.split.size();
+      Iterator from = next;
+      for (std::size_t i = 0; i < 3 && next != end; ++i, ++next)
+        state.split += *next;
+      const Char* first = state.split.data();
+      const Char* stop = first;
+      push_result r = push_scan(f, state, stop, first + state.split.size(),
+                                false, tok, true);
+      std::size_t used = static_cast<std::size_t>(stop - first);
+      if (r == push_finished) {
+        state.done = true;
+        state.split.clear();
+        next = end;
+        return false;
+      }
+      if (r == push_found) {
+        // The token ended before the split character, or after it.
+        next = from;
+        if (used < kept)
+          state.split.resize(kept);
+        else {
+          std::advance(next, used - kept);
+          state.split.clear();
+        }
+        return true;
+      }
+      state.split.erase(0, r == push_split ? used : state.split.size());
+    }
+    return false;
+  }
+
+  // Keeps n characters of pending from pos on. The token just found may be
+  // read from pending until the next call, so its storage is moved aside
+  // into split, which functions without a push member do not use.
+  template <class TokenizerFunc, class Char>
+  void keep_pending(push_state<TokenizerFunc,Char>& state, std::size_t pos,
+                    std::size_t n)
+  {
+    state.split.assign(state.pending, pos, n);
+    state.pending.swap(state.split);
+  }
+
+  // push_token for a function without a push member: the input of a token
+  // that reaches the end of a buffer is copied into state, the next buffer
+  // is appended to it, and the token is found again there.
+  template <class TokenizerFunc, class Char, class Iterator, class Type>
+  bool push_buffer(TokenizerFunc& f, push_state<TokenizerFunc,Char>& state,
+                   Iterator& next, Iterator end, Type& tok, const false_type&)
+  {
+    if (state.pending.empty()) {
+      Iterator stop = next;
+      switch (push_scan(f, state, stop, end, false, tok)) {
+      case push_found:
+        next = stop;
+        return true;
+      case push_finished:
+        state.done = true;
+        break;
+      case push_more:
+        state.pending.assign(next, end);
+        break;
+      default:
+        break;
+      }
+      next = end;
+      return false;
+    }
+
+    // The token started in an earlier buffer.
+    std::size_t kept = state.pending.size();
+    state.pending.append(next, end);
+    const Char* first = state.pending.data();
+    const Char* stop = first;
+    switch (push_scan(f, state, stop, first + state.pending.size(), false,
+                      tok)) {
+    case push_found: {
+      std::size_t used = static_cast<std::size_t>(stop - first);
+      if (used < kept)
+        keep_pending(state, used, kept - used);
+      else {
+        std::advance(next, used - kept);
+        keep_pending(state, 0, 0);
+      }
+      return true;
+    }
+    case push_finished:
+      state.done = true;
+      state.pending.clear();
+      break;
+    case push_skipped:
+      state.pending.clear();
+      break;
+    default:
+      break;
+    }
+    next = end;
+    return false;
+  }
+
+  // finish_tokens for a function with a push member: the end of the input
+  // completes the character cut in two, if any, and then the parse saved
+  // in state.
+  template <class TokenizerFunc, class Char, class Type>
+  bool finish_buffer(TokenizerFunc& f, push_state<TokenizerFunc,Char>& state,
+                     Type& tok, const true_type&)
+  {
+    const Char* first = state.split.data();
+    const Char* stop = first;
+    if (state.split.empty())
+      return push_scan(f, state, stop, stop, true, tok) == push_found;
+    if (push_scan(f, state, stop, first + state.split.size(), true, tok,
+                  true) != push_found)
+      return false;
+    state.split.erase(0, static_cast<std::size_t>(stop - first));
+    return true;
+  }
+
+  // finish_tokens for a function without a push member: the input kept in
+  // state is scanned as the end of the input.
+  template <class TokenizerFunc, class Char, class Type>
+  bool finish_buffer(TokenizerFunc& f, push_state<TokenizerFunc,Char>& state,
+                     Type& tok, const false_type&)
+  {
+    const Char* first = state.pending.data();
+    const Char* stop = first;
+    if (push_scan(f, state, stop, first + state.pending.size(), true, tok) !=
+        push_found)
+      return false;
+    std::size_t used = static_cast<std::size_t>(stop - first);
+    keep_pending(state, used, state.pending.size() - used);
+    return true;
+  }
+
+  } // namespace tokenizer_detail
+
+
+  //===========================================================================
+  // push_token and finish_tokens drive a TokenizerFunction in push mode, over
+  // buffers that arrive one after the other and that need not be kept once
+  // they have been read, such as the two halves of a ring buffer or the
+  // receive buffers of a network card.
+  //
+  // push_token reads from [next, end) until a token is complete, stores it
+  // in tok and returns true; it returns false once the buffer is used up,
+  // with next == end. Call it again with the next buffer. After the last
+  // buffer, call finish_tokens until it returns false to get the tokens that
+  // the end of the input completes. The tokens are the same as those of a
+  // tokenizer over the concatenation of all the buffers.
+  //
+  // The separators of this library have a push member (see
+  // has_token_push), which runs their own parsing loop over the buffer and
+  // saves the parse of a token that reaches the end of it in the state, so
+  // that every character is read once. Other TokenizerFunctions can be used
+  // as long as they do not look beyond the end of the token they return and
+  // do not fail at the end of a token that more input would complete: the
+  // input of a token that reaches the end of a buffer is copied into the
+  // state, and the token is found again with the next buffer, which costs
+  // time in the square of the number of buffers a token spans.
+  //
+  // A token that lies in one buffer is assigned from the buffer. One that
+  // spans buffers, or that the separator builds a character at a time such
+  // as the fields of escaped_list_separator, is assigned from a range of
+  // const Char* into the state, which stays valid until the next call with
+  // that state. A token type that refers to the input, such as token_view,
+  // must be able to hold both kinds of range, and is only valid until then.
+  //
+  // The buffers must be forward iterator ranges. Errors are reported as by
+  // the tokenizer; an escape character at the end of a buffer is only an
+  // error if the input ends there.
+
+  template <class TokenizerFunc, class Char, class Iterator, class Type>
+  bool push_token(TokenizerFunc& f, push_state<TokenizerFunc,Char>& state,
+                  Iterator& next, Iterator end, Type& tok)
+  {
+    if (next == end)
+      return false;
+    if (state.done) {
+      next = end;
+      return false;
+    }
+    state.seen_input = true;
+    return tokenizer_detail::push_buffer(f, state, next, end, tok,
+                                         has_token_push<TokenizerFunc>());
+  }
+
+  template <class TokenizerFunc, class Char, class Type>
+  bool finish_tokens(TokenizerFunc& f, push_state<TokenizerFunc,Char>& state,
+                     Type& tok)
+  {
+    using namespace tokenizer_detail;
+
+    // As for a tokenizer, an empty input has no tokens.
+    if (state.done || !state.seen_input)
+      return false;
+    if (finish_buffer(f, state, tok, has_token_push<TokenizerFunc>()))
+      return true;
+    state.done = true;
+    state.pending.clear();
+    state.split.clear();
+    return false;
+  }
+
+
+  //===========================================================================
+  // The push_tokenizer class bundles a TokenizerFunction with a push_state.
+  //
+  //   push_tokenizer<char_separator<char> > t(sep);
+  //   std::string tok;
+  //   while (const char* p = receive(n)) {
+  //     const char* e = p + n;
+  //     while (t.push(p, e, tok)) use(tok);
+  //   }
+  //   while (t.finish(tok)) use(tok);
+
+  template <class TokenizerFunc, class Type = std::string>
+  class push_tokenizer {
+  public:
+    typedef push_state<TokenizerFunc, BOOST_DEDUCED_TYPENAME Type::value_type>
+      state_type;
+
+    explicit push_tokenizer(const TokenizerFunc& f = TokenizerFunc())
+      : f_(f), state_(f) { }
+
+    template <class Iterator>
+    bool push(Iterator& next, Iterator end, Type& tok) {
+      return push_token(f_, state_, next, end, tok);
+    }
+
+    bool finish(Type& tok) {
+      return finish_tokens(f_, state_, tok);
+    }
+
+    // Starts over with a new input.
+    void reset() { state_ = state_type(f_); }
+
+    const TokenizerFunc& tokenizer_function() const { return f_; }
+
+    const state_type& state() const { return state_; }
+    void state(const state_type& s) { state_ = s; }
+
+  private:
+    TokenizerFunc f_;
+    state_type state_;
+  };
+
+} // namespace boost
+
+#endif
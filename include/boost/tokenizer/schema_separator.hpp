@@ -0,0 +1,247 @@
+// Boost tokenizer/schema_separator.hpp  ------------------------------------//
+
+// Copyright 2026 Boost.Tokenizer contributors.
+
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// See http://www.boost.org/libs/tokenizer for documentation.
+
+#ifndef BOOST_TOKENIZER_SCHEMA_SEPARATOR_HPP_
+#define BOOST_TOKENIZER_SCHEMA_SEPARATOR_HPP_
+
+#include <cstddef>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <boost/throw_exception.hpp>
+#include <boost/token_functions.hpp>
+
+namespace boost {
+
+  struct record_schema_error : public std::runtime_error {
+    record_schema_error(const std::string& what_arg)
+      : std::runtime_error(what_arg) { }
+  };
+
+  enum length_encoding { decimal_length, binary_length };
+
+
+  //===========================================================================
+  // A record_schema describes the fields of a record, in order, for
+  // schema_separator. Each member adds a step and returns *this, so that a
+  // schema is written as one expression:
+  //
+  //   record_schema().length(4).counted_field()        // "0005hello"
+  //   record_schema().field(2).length(1, binary_length).counted_field()
+  //
+  // field(w) is a token of w characters. length(w) reads w characters as a
+  // length, in decimal digits or as big endian bytes, and is not a token;
+  // counted_field() is a token as long as the last length read. skip(w)
+  // and skip_counted() pass over characters without a token.
+
+  class record_schema {
+  public:
+    record_schema& field(std::size_t width) { return add(fixed_step, width); }
+    record_schema& counted_field() { return add(counted_step, 0); }
+    record_schema& length(std::size_t width,
+                          length_encoding encoding = decimal_length) {
+      return add(encoding == decimal_length ? decimal_step : binary_step,
+                 width);
+    }
+    record_schema& skip(std::size_t width) { return add(skip_step, width); }
+    record_schema& skip_counted() { return add(skip_counted_step, 0); }
+
+    std::size_t size() const { return steps_.size(); }
+    bool empty() const { return steps_.empty(); }
+
+  private:
+    friend class schema_separator;
+
+    enum step_kind {
+      fixed_step, counted_step, decimal_step, binary_step, skip_step,
+      skip_counted_step
+    };
+
+    struct step {
+      step_kind kind;
+      std::size_t width;
+    };
+
+    record_schema& add(step_kind kind, std::size_t width) {
+      step s = { kind, width };
+      steps_.push_back(s);
+      return *this;
+    }
+
+    std::vector<step> steps_;
+  };
+
+
+  //===========================================================================
+  // The schema_separator class is a model of TokenizerFunction that slices
+  // records by a record_schema, with field widths that are either fixed or
+  // read from the data itself, as in length prefixed and TLV formats. With
+  // repeat, the schema is applied again after each record, until the input
+  // ends at the end of a record; otherwise only one record is read.
+  //
+  // For random access iterators each field is found in constant time, by
+  // moving the iterator by its width; other iterators are read a character
+  // at a time. Input that ends inside a record, and a length that is not
+  // made of decimal digits or does not fit a std::size_t, throw
+  // record_schema_error. A repeated schema whose steps are all 0 wide, such
+  // as record_schema().field(0), would find empty tokens forever, so the
+  // constructor throws record_schema_error for it.
+
+  class schema_separator {
+  public:
+    explicit schema_separator(const record_schema& schema = record_schema(),
+                              bool repeat = true)
+      : steps_(schema.steps_), current_(0), length_(0), repeat_(repeat)
+    {
+      if (repeat_ && !reads_input())
+        BOOST_THROW_EXCEPTION(record_schema_error(
+          std::string("schema_separator: a repeated schema reads nothing")));
+    }
+
+    void reset() {
+      current_ = 0;
+      length_ = 0;
+    }
+
+    template <typename InputIterator, typename Token>
+    bool operator()(InputIterator& next, InputIterator end, Token& tok)
+    {
+      typedef BOOST_DEDUCED_TYPENAME tokenizer_detail::get_iterator_category<
+        InputIterator
+      >::iterator_category category;
+
+      for (;;) {
+        if (current_ == steps_.size()) {
+          if (!repeat_ || steps_.empty())
+            return false;
+          current_ = 0;
+        }
+        if (current_ == 0 && next == end)
+          return false;
+
+        const record_schema::step& s = steps_[current_++];
+        tokenizer_detail::discard_token skipped;
+        switch (s.kind) {
+        case record_schema::fixed_step:
+          take(next, end, s.width, tok, category());
+          return true;
+        case record_schema::counted_step:
+          take(next, end, length_, tok, category());
+          return true;
+        case record_schema::skip_step:
+          take(next, end, s.width, skipped, category());
+          break;
+        case record_schema::skip_counted_step:
+          take(next, end, length_, skipped, category());
+          break;
+        default:
+          length_ = read_length(next, end, s);
+          break;
+        }
+      }
+    }
+
+    // Like operator(), but only finds the end of the token.
+    template <typename InputIterator>
+    bool skip(InputIterator& next, InputIterator end) {
+      tokenizer_detail::discard_token tok;
+      return (*this)(next, end, tok);
+    }
+
+  private:
+    // Whether a record takes at least one character, or there are no
+    // records. Counted steps only take characters when a length step
+    // before them has taken some.
+    bool reads_input() const {
+      if (steps_.empty())
+        return true;
+      for (std::size_t i = 0; i < steps_.size(); ++i)
+        if (steps_[i].width != 0)
+          return true;
+      return false;
+    }
+
+    static void truncated() {
+      BOOST_THROW_EXCEPTION(record_schema_error(
+        std::string("schema_separator: input ends inside a record")));
+    }
+
+    static void bad_length() {
+      BOOST_THROW_EXCEPTION(record_schema_error(
+        std::string("schema_separator: bad length field")));
+    }
+
+    template <typename Iterator, typename Token>
+    static void take(Iterator& next, Iterator end, std::size_t n, Token& tok,
+                     std::random_access_iterator_tag)
+    {
+      if (static_cast<std::size_t>(end - next) < n)
+        truncated();
+      Iterator start(next);
+      next += static_cast<
+        BOOST_DEDUCED_TYPENAME std::iterator_traits<Iterator>::difference_type
+      >(n);
+      tok.assign(start, next);
+    }
+
+    template <typename InputIterator, typename Token, typename Category>
+    static void take(InputIterator& next, InputIterator end, std::size_t n,
+                     Token& tok, Category)
+    {
+      typedef tokenizer_detail::assign_or_plus_equal<Category> assigner;
+
+      assigner::clear(tok);
+      InputIterator start(next);
+      for (std::size_t i = 0; i < n; ++i, ++next) {
+        if (next == end)
+          truncated();
+        assigner::plus_equal(tok, *next);
+      }
+      assigner::assign(start, next, tok);
+    }
+
+    template <typename InputIterator>
+    static std::size_t read_length(InputIterator& next, InputIterator end,
+                                   const record_schema::step& s)
+    {
+      const std::size_t max = static_cast<std::size_t>(-1);
+      std::size_t value = 0;
+      for (std::size_t i = 0; i < s.width; ++i, ++next) {
+        if (next == end)
+          truncated();
+        if (s.kind == record_schema::binary_step) {
+          if (value > (max >> 8))
+            bad_length();
+          value = value * 256 + static_cast<unsigned char>(*next);
+        }
+        else {
+          int digit = static_cast<int>(*next) - '0';
+          if (digit < 0 || digit > 9 ||
+              value > (max - static_cast<std::size_t>(digit)) / 10)
+            bad_length();
+          value = value * 10 + static_cast<std::size_t>(digit);
+        }
+      }
+      return value;
+    }
+
+    std::vector<record_schema::step> steps_;
+    std::size_t current_;
+    std::size_t length_;
+    bool repeat_;
+  };
+
+  template <>
+  struct has_token_skip<schema_separator> : public true_type { };
+
+} // namespace boost
+
+#endif
@@ -0,0 +1,269 @@
+// Boost tokenizer/separator_spec.hpp  --------------------------------------//
+
+// Copyright 2026 Boost.Tokenizer contributors.
+
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// See http://www.boost.org/libs/tokenizer for documentation.
+
+#ifndef BOOST_TOKENIZER_SEPARATOR_SPEC_HPP_
+#define BOOST_TOKENIZER_SEPARATOR_SPEC_HPP_
+
+#include <string>
+#include <boost/assert.hpp>
+#include <boost/token_functions.hpp>
+#include <boost/type_traits/integral_constant.hpp>
+#include <boost/type_traits/make_unsigned.hpp>
+
+namespace boost {
+
+  namespace tokenizer_detail {
+
+  // A table with one entry per character value below 256. Wider characters
+  // with larger values are classified by the separator the table was built
+  // from.
+  template <class Char>
+  struct byte_table {
+    unsigned char entries[256];
+
+    static bool index(Char c, unsigned& i) {
+      typedef BOOST_DEDUCED_TYPENAME make_unsigned<Char>::type uchar;
+      uchar u = static_cast<uchar>(c);
+      if ((u >> 8) != 0)
+        return false;
+      i = static_cast<unsigned>(u);
+      return true;
+    }
+
+    // The character whose entry is entries[i], the inverse of index(): a
+    // signed char above 127 is the negative value that holds byte i, and
+    // the separators classify it as that byte.
+    static Char at(unsigned i) {
+      typedef BOOST_DEDUCED_TYPENAME make_unsigned<Char>::type uchar;
+      return static_cast<Char>(static_cast<uchar>(i));
+    }
+  };
+
+  } // namespace tokenizer_detail
+
+
+  //===========================================================================
+  // A separator spec is the immutable part of a separator: its delimiters,
+  // compiled into a table of character classes when the spec is built. All
+  // member functions are const and do not change the spec, so one spec can
+  // be shared by const reference between any number of threads.
+  //
+  // The parse state that a separator keeps between two tokens is a single
+  // bool, held by shared_separator (below) or by the caller.
+
+  template <class Char,
+    class Tr = BOOST_DEDUCED_TYPENAME std::basic_string<Char>::traits_type >
+  class char_separator_spec {
+  public:
+    typedef bool state_type;
+
+    explicit char_separator_spec(const Char* dropped_delims,
+                                 const Char* kept_delims = 0,
+                                 empty_token_policy empty_tokens =
+                                   drop_empty_tokens)
+      : sep_(dropped_delims, kept_delims, empty_tokens) { build(); }
+
+    // isspace() for dropped delimiters and ispunct() for kept ones.
+    char_separator_spec() : sep_() { build(); }
+
+    explicit char_separator_spec(const char_separator<Char,Tr>& sep)
+      : sep_(sep) { sep_.reset(); build(); }
+
+    bool is_dropped(Char c) const {
+      unsigned i;
+      if (table::index(c, i))
+        return (table_.entries[i] & dropped) != 0;
+      return sep_.is_dropped(c);
+    }
+
+    bool is_kept(Char c) const {
+      unsigned i;
+      if (table::index(c, i))
+        return (table_.entries[i] & kept) != 0;
+      return sep_.is_kept(c);
+    }
+
+    bool is_delimiter(Char c) const {
+      unsigned i;
+      if (table::index(c, i))
+        return table_.entries[i] != 0;
+      return sep_.is_delimiter(c);
+    }
+
+    unsigned delimiter_mask(Char c) const {
+      unsigned i;
+      if (table::index(c, i))
+        return table_.entries[i];
+      return sep_.delimiter_mask(c);
+    }
+
+    // Finds the next token as char_separator does, with the state passed
+    // in; a new input starts with state == state_type().
+    template <typename InputIterator, typename Token>
+    bool next_token(state_type& state, InputIterator& next,
+                    InputIterator end, Token& tok) const {
+      return char_separator<Char,Tr>::scan(*this, sep_.m_empty_tokens,
+                                           state, next, end, tok);
+    }
+
+  private:
+    typedef tokenizer_detail::byte_table<Char> table;
+    enum {
+      dropped = tokenizer_detail::dropped_delimiter,
+      kept = tokenizer_detail::kept_delimiter
+    };
+
+    void build() {
+      for (unsigned i = 0; i < 256; ++i) {
+        Char c = table::at(i);
+        table_.entries[i] = static_cast<unsigned char>(
+          (sep_.is_dropped(c) ? dropped : 0) | (sep_.is_kept(c) ? kept : 0));
+      }
+    }
+
+    char_separator<Char,Tr> sep_;
+    table table_;
+  };
+
+  template <class Char,
+    class Traits = BOOST_DEDUCED_TYPENAME std::basic_string<Char>::traits_type >
+  class escaped_list_spec {
+    typedef std::basic_string<Char,Traits> string_type;
+  public:
+    typedef bool state_type;
+
+    explicit escaped_list_spec(Char e = '\\', Char c = ',', Char q = '\"')
+      : sep_(e, c, q) { build(); }
+
+    escaped_list_spec(string_type e, string_type c, string_type q)
+      : sep_(e, c, q) { build(); }
+
+    explicit escaped_list_spec(const escaped_list_separator<Char,Traits>& sep)
+      : sep_(sep) { sep_.reset(); build(); }
+
+    bool is_escape(Char c) const { return is(c, escape); }
+    bool is_c(Char c) const { return is(c, separator); }
+    bool is_quote(Char c) const { return is(c, quote); }
+
+    // Finds the next token as escaped_list_separator does, with the state
+    // passed in; a new input starts with state == state_type().
+    template <typename InputIterator, typename Token>
+    bool next_token(state_type& state, InputIterator& next,
+                    InputIterator end, Token& tok) const {
+      tokenizer_detail::null_observer obs;
+      return next_token(state, next, end, tok, obs);
+    }
+
+    // Same as above, and also tells obs about every escape sequence and
+    // quote character it parses.
+    template <typename InputIterator, typename Token, typename Observer>
+    bool next_token(state_type& state, InputIterator& next,
+                    InputIterator end, Token& tok, Observer& obs) const {
+      return escaped_list_separator<Char,Traits>::scan(*this, state, next,
+                                                       end, tok, obs);
+    }
+
+    // View mode, as escaped_list_separator has it.
+    template <typename Iterator>
+    bool next_token(state_type& state, Iterator& next, Iterator end,
+                    escaped_field<Iterator>& field) const {
+      return escaped_list_separator<Char,Traits>::scan_field(*this, state,
+                                                             next, end,
+                                                             field);
+    }
+
+    template <typename Iterator, typename Token>
+    void unescape_into(const escaped_field<Iterator>& field,
+                       Token& tok) const {
+      escaped_list_separator<Char,Traits>::unescape_into(*this, field, tok);
+    }
+
+  private:
+    typedef tokenizer_detail::byte_table<Char> table;
+    enum { escape = 1, separator = 2, quote = 4 };
+
+    bool is(Char c, unsigned char cls) const {
+      unsigned i;
+      if (table::index(c, i))
+        return (table_.entries[i] & cls) != 0;
+      switch (cls) {
+      case escape: return sep_.is_escape(c);
+      case separator: return sep_.is_c(c);
+      default: return sep_.is_quote(c);
+      }
+    }
+
+    void build() {
+      for (unsigned i = 0; i < 256; ++i) {
+        Char c = table::at(i);
+        table_.entries[i] = static_cast<unsigned char>(
+          (sep_.is_escape(c) ? escape : 0) | (sep_.is_c(c) ? separator : 0) |
+          (sep_.is_quote(c) ? quote : 0));
+      }
+    }
+
+    escaped_list_separator<Char,Traits> sep_;
+    table table_;
+  };
+
+
+  //===========================================================================
+  // The shared_separator class is a model of TokenizerFunction that refers
+  // to a separator spec and holds only the parse state, so that copying it,
+  // as the token iterators do, costs a pointer and a bool. The spec must
+  // outlive it.
+  //
+  //   static const char_separator_spec<char> spec(" ,;");   // built once
+  //   tokenizer<shared_separator<char_separator_spec<char> > >
+  //     tok(line, shared_separator<char_separator_spec<char> >(spec));
+
+  template <class Spec>
+  class shared_separator {
+  public:
+    shared_separator() : spec_(0), state_() { }
+    explicit shared_separator(const Spec& spec) : spec_(&spec), state_() { }
+
+    void reset() { state_ = BOOST_DEDUCED_TYPENAME Spec::state_type(); }
+
+    template <typename InputIterator, typename Token>
+    bool operator()(InputIterator& next, InputIterator end, Token& tok) {
+      BOOST_ASSERT(spec_);
+      return spec_->next_token(state_, next, end, tok);
+    }
+
+    // Passes an observer on to specs that report events, such as
+    // escaped_list_spec.
+    template <typename InputIterator, typename Token, typename Observer>
+    bool operator()(InputIterator& next, InputIterator end, Token& tok,
+                    Observer& obs) {
+      BOOST_ASSERT(spec_);
+      return spec_->next_token(state_, next, end, tok, obs);
+    }
+
+    // Like operator(), but only finds the end of the token.
+    template <typename InputIterator>
+    bool skip(InputIterator& next, InputIterator end) {
+      tokenizer_detail::discard_token tok;
+      return (*this)(next, end, tok);
+    }
+
+    const Spec& spec() const { return *spec_; }
+
+  private:
+    const Spec* spec_;
+    BOOST_DEDUCED_TYPENAME Spec::state_type state_;
+  };
+
+  template <class Spec>
+  struct has_token_skip<shared_separator<Spec> > : public true_type { };
+
+} // namespace boost
+
+#endif
@@ -0,0 +1,96 @@
+// Boost tokenizer/tagged_token.hpp  ----------------------------------------//
+
+// Copyright 2026 Boost.Tokenizer contributors.
+
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// See http://www.boost.org/libs/tokenizer for documentation.
+
+#ifndef BOOST_TOKENIZER_TAGGED_TOKEN_HPP_
+#define BOOST_TOKENIZER_TAGGED_TOKEN_HPP_
+
+#include <boost/assert.hpp>
+#include <boost/config.hpp>
+#include <boost/token_functions.hpp>
+#include <boost/tokenizer/token_view.hpp>
+
+namespace boost {
+
+  //===========================================================================
+  // A tagged_token is a token_view that also records whether the token is
+  // data or a kept delimiter, as the separators with kept delimiters
+  // (char_separator, char_separator_spec, constexpr_char_separator and
+  // ascii_word_separator) report it. So a kept delimiter is told apart
+  // from data by its kind, and read as a single char, with no string built
+  // for it:
+  //
+  //   typedef std::string::const_iterator iter;
+  //   tokenizer<char_separator<char>, iter, tagged_token<iter> >
+  //     tok(expr, char_separator<char>(" ", "+-*/()"));
+  //   for (...; ++it)
+  //     if (it->is_delimiter()) apply(it->delimiter()); else push(*it);
+  //
+  // Like token_view, it requires forward iterators, and is only valid
+  // while the input is.
+
+  template <class Iterator>
+  class tagged_token : public token_view<Iterator> {
+  public:
+    typedef BOOST_DEDUCED_TYPENAME token_view<Iterator>::value_type
+      value_type;
+
+    BOOST_CONSTEXPR tagged_token() : token_view<Iterator>(), kind_(data_token)
+    { }
+    BOOST_CONSTEXPR tagged_token(Iterator first, Iterator last,
+                                 token_kind kind = data_token)
+      : token_view<Iterator>(first, last), kind_(kind) { }
+
+    BOOST_CONSTEXPR token_kind kind() const { return kind_; }
+    BOOST_CONSTEXPR bool is_delimiter() const {
+      return kind_ == delimiter_token;
+    }
+    BOOST_CXX14_CONSTEXPR void set_kind(token_kind kind) { kind_ = kind; }
+
+    // The kept delimiter that this token is.
+    BOOST_CXX14_CONSTEXPR value_type delimiter() const {
+      BOOST_ASSERT(is_delimiter());
+      return *this->begin();
+    }
+
+  private:
+    token_kind kind_;
+  };
+
+  template <class Iterator>
+  bool operator==(const tagged_token<Iterator>& a,
+                  const tagged_token<Iterator>& b)
+  {
+    return a.kind() == b.kind() &&
+      static_cast<const token_view<Iterator>&>(a) ==
+      static_cast<const token_view<Iterator>&>(b);
+  }
+
+  template <class Iterator>
+  bool operator!=(const tagged_token<Iterator>& a,
+                  const tagged_token<Iterator>& b)
+  {
+    return !(a == b);
+  }
+
+  namespace tokenizer_detail {
+
+  template <class Iterator>
+  struct token_kind_traits<tagged_token<Iterator> > {
+    static BOOST_CXX14_CONSTEXPR void set(tagged_token<Iterator>& tok,
+                                          token_kind kind) {
+      tok.set_kind(kind);
+    }
+  };
+
+  } // namespace tokenizer_detail
+
+} // namespace boost
+
+#endif
@@ -0,0 +1,201 @@
+// Boost tokenizer/token_batch.hpp  -----------------------------------------//
+
+// Copyright 2026 Boost.Tokenizer contributors.
+
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// See http://www.boost.org/libs/tokenizer for documentation.
+
+#ifndef BOOST_TOKENIZER_TOKEN_BATCH_HPP_
+#define BOOST_TOKENIZER_TOKEN_BATCH_HPP_
+
+#include <cstddef>
+#include <string>
+#include <utility>
+#include <vector>
+#include <boost/assert.hpp>
+#include <boost/token_functions.hpp>
+
+namespace boost {
+
+  //===========================================================================
+  // The token_batch class holds the tokens of many inputs in three flat
+  // arrays: the characters of all tokens back to back, the offset at which
+  // each token ends, and the number of tokens each input ends with. Token t
+  // is [token_offsets()[t], token_offsets()[t+1]) of chars(), and the tokens
+  // of input i are [input_offsets()[i], input_offsets()[i+1]).
+
+  template <class Char = char,
+    class Tr = BOOST_DEDUCED_TYPENAME std::basic_string<Char>::traits_type >
+  class token_batch {
+  public:
+    typedef std::basic_string<Char,Tr> string_type;
+    typedef std::size_t size_type;
+
+    token_batch() : token_offsets_(1, 0), input_offsets_(1, 0) { }
+
+    void clear() {
+      chars_.clear();
+      token_offsets_.assign(1, 0);
+      input_offsets_.assign(1, 0);
+    }
+
+    // The number of inputs.
+    size_type size() const { return input_offsets_.size() - 1; }
+    bool empty() const { return size() == 0; }
+
+    size_type token_count() const { return token_offsets_.size() - 1; }
+
+    // The indices of the tokens of an input, as [first, second).
+    std::pair<size_type,size_type> tokens_of(size_type input) const {
+      BOOST_ASSERT(input < size());
+      return std::make_pair(input_offsets_[input], input_offsets_[input + 1]);
+    }
+
+    const Char* token_data(size_type t) const {
+      BOOST_ASSERT(t < token_count());
+      return chars_.data() + token_offsets_[t];
+    }
+
+    size_type token_size(size_type t) const {
+      BOOST_ASSERT(t < token_count());
+      return token_offsets_[t + 1] - token_offsets_[t];
+    }
+
+    string_type token(size_type t) const {
+      return string_type(token_data(t), token_size(t));
+    }
+
+    const string_type& chars() const { return chars_; }
+    const std::vector<size_type>& token_offsets() const {
+      return token_offsets_;
+    }
+    const std::vector<size_type>& input_offsets() const {
+      return input_offsets_;
+    }
+
+    // Reserves room for the given numbers of characters, tokens and inputs.
+    void reserve(size_type chars, size_type tokens, size_type inputs) {
+      chars_.reserve(chars);
+      token_offsets_.reserve(tokens + 1);
+      input_offsets_.reserve(inputs + 1);
+    }
+
+  private:
+    template <class TokenizerFunc, class Iterator, class C, class T>
+    friend void append_tokens(TokenizerFunc&, Iterator, Iterator,
+                              token_batch<C,T>&);
+
+    string_type chars_;
+    std::vector<size_type> token_offsets_;
+    std::vector<size_type> input_offsets_;
+  };
+
+  namespace tokenizer_detail {
+
+  // The token type used to fill a token_batch. It writes straight into the
+  // character array of the batch, after the tokens already there. The
+  // models empty their token through token_clear_traits, which calls
+  // clear(), or, in the loops of assign_or_plus_equal over input
+  // iterators, with tok = Token(); both drop the characters written so
+  // far.
+  template <class String>
+  class batch_token {
+  public:
+    batch_token() : chars_(0), start_(0) { }
+    explicit batch_token(String& chars)
+      : chars_(&chars), start_(chars.size()) { }
+
+    batch_token& operator=(const batch_token&) {
+      clear();
+      return *this;
+    }
+
+    void clear() {
+      if (chars_)
+        chars_->resize(start_);
+    }
+
+    template <class Iterator>
+    void assign(Iterator first, Iterator last) {
+      chars_->resize(start_);
+      chars_->append(first, last);
+    }
+
+    template <class Value>
+    batch_token& operator+=(const Value& c) {
+      chars_->push_back(c);
+      return *this;
+    }
+
+    std::size_t size() const { return chars_->size() - start_; }
+
+  private:
+    String* chars_;
+    std::size_t start_;
+  };
+
+  template <class String>
+  struct token_clear_traits<batch_token<String> > {
+    static void clear(batch_token<String>& t) { t.clear(); }
+  };
+
+  } // namespace tokenizer_detail
+
+  // Tokenizes [first, last) into the batch, as one more input.
+  template <class TokenizerFunc, class Iterator, class Char, class Tr>
+  void append_tokens(TokenizerFunc& f, Iterator first, Iterator last,
+                     token_batch<Char,Tr>& out)
+  {
+    typedef BOOST_DEDUCED_TYPENAME token_batch<Char,Tr>::string_type
+      string_type;
+
+    f.reset();
+    // As with token_iterator, an empty input has no tokens.
+    if (first != last) {
+      for (;;) {
+        std::size_t start = out.chars_.size();
+        tokenizer_detail::batch_token<string_type> tok(out.chars_);
+        if (!f(first, last, tok)) {
+          out.chars_.resize(start);
+          break;
+        }
+        out.token_offsets_.push_back(out.chars_.size());
+      }
+    }
+    out.input_offsets_.push_back(out.token_offsets_.size() - 1);
+  }
+
+
+  //===========================================================================
+  // tokenize_batch tokenizes a sequence of inputs with a single copy of the
+  // TokenizerFunction, which is reset before each input, and appends the
+  // tokens to a token_batch. Each input is a container of characters, such
+  // as a std::string. The tokens of an input are the same as those of a
+  // tokenizer over it.
+  //
+  // Building a tokenizer per input copies the TokenizerFunction, and with it
+  // the strings of delimiters it holds, and gives each token its own
+  // string; a batch does neither, so the cost of a short input is little
+  // more than the cost of scanning it.
+
+  template <class InputsIterator, class TokenizerFunc, class Char, class Tr>
+  void tokenize_batch(InputsIterator first, InputsIterator last,
+                      TokenizerFunc f, token_batch<Char,Tr>& out)
+  {
+    for (; first != last; ++first)
+      append_tokens(f, first->begin(), first->end(), out);
+  }
+
+  template <class Inputs, class TokenizerFunc, class Char, class Tr>
+  void tokenize_batch(const Inputs& inputs, const TokenizerFunc& f,
+                      token_batch<Char,Tr>& out)
+  {
+    tokenize_batch(inputs.begin(), inputs.end(), f, out);
+  }
+
+} // namespace boost
+
+#endif
@@ -0,0 +1,100 @@
+// Boost tokenizer/token_view.hpp  ------------------------------------------//
+
+// Copyright 2026 Boost.Tokenizer contributors.
+
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// See http://www.boost.org/libs/tokenizer for documentation.
+
+#ifndef BOOST_TOKENIZER_TOKEN_VIEW_HPP_
+#define BOOST_TOKENIZER_TOKEN_VIEW_HPP_
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <string>
+#include <boost/config.hpp>
+#include <boost/static_assert.hpp>
+
+namespace boost {
+
+  //===========================================================================
+  // A token_view is a token type that refers to the characters of the
+  // token in the input instead of copying them. Any TokenizerFunction that
+  // builds its tokens with assign(first, last) can return it:
+  //
+  //   tokenizer<char_separator<char>, std::string::const_iterator,
+  //             token_view<std::string::const_iterator> > tok(s, sep);
+  //
+  // Of the models in this library, char_separator, offset_separator,
+  // line_separator, schema_separator, unicode_separator, word_separator,
+  // ascii_word_separator, the constexpr separators and shared_separator
+  // over a char_separator_spec do so for forward iterators.
+  // escaped_list_separator, lenient_escaped_list_separator and
+  // char_delimiters_separator build their tokens with += instead, since
+  // a token need not be a range of the input, and do not compile with a
+  // token_view.
+  //
+  // The views are only valid while the input is.
+
+  template <class Iterator>
+  class token_view {
+  public:
+    typedef Iterator iterator;
+    typedef Iterator const_iterator;
+    typedef BOOST_DEDUCED_TYPENAME
+      std::iterator_traits<Iterator>::value_type value_type;
+    typedef std::size_t size_type;
+
+    BOOST_CONSTEXPR token_view() : first_(), last_() { }
+    BOOST_CONSTEXPR token_view(Iterator first, Iterator last)
+      : first_(first), last_(last) { }
+
+    BOOST_CXX14_CONSTEXPR void assign(Iterator first, Iterator last) {
+      first_ = first;
+      last_ = last;
+    }
+
+    // Only there to reject, with a readable message, the TokenizerFunctions
+    // that build their tokens a character at a time.
+    template <class Value>
+    token_view& operator+=(const Value&) {
+      BOOST_STATIC_ASSERT_MSG(sizeof(Value) == 0,
+        "token_view only works with TokenizerFunctions that build their "
+        "tokens with assign(first, last)");
+      return *this;
+    }
+
+    BOOST_CONSTEXPR Iterator begin() const { return first_; }
+    BOOST_CONSTEXPR Iterator end() const { return last_; }
+    BOOST_CONSTEXPR bool empty() const { return first_ == last_; }
+    BOOST_CXX14_CONSTEXPR size_type size() const {
+      return static_cast<size_type>(std::distance(first_, last_));
+    }
+
+    std::basic_string<value_type> str() const {
+      return std::basic_string<value_type>(first_, last_);
+    }
+
+  private:
+    Iterator first_;
+    Iterator last_;
+  };
+
+  template <class Iterator>
+  bool operator==(const token_view<Iterator>& a, const token_view<Iterator>& b)
+  {
+    return a.size() == b.size() && std::equal(a.begin(), a.end(), b.begin());
+  }
+
+  template <class Iterator>
+  bool operator!=(const token_view<Iterator>& a, const token_view<Iterator>& b)
+  {
+    return !(a == b);
+  }
+
+} // namespace boost
+
+#endif
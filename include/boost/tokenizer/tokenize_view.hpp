@@ -0,0 +1,190 @@
+// Boost tokenizer/tokenize_view.hpp  ---------------------------------------//
+
+// Copyright 2026 Boost.Tokenizer contributors.
+
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// See http://www.boost.org/libs/tokenizer for documentation.
+
+#ifndef BOOST_TOKENIZER_TOKENIZE_VIEW_HPP_
+#define BOOST_TOKENIZER_TOKENIZE_VIEW_HPP_
+
+#include <boost/tokenizer/detail/config.hpp>
+
+#if defined(BOOST_TOKENIZER_HAS_RANGES)
+
+#include <cstddef>
+#include <iterator>
+#include <ranges>
+#include <string>
+#include <utility>
+#include <boost/assert.hpp>
+#include <boost/token_functions.hpp>
+
+namespace boost {
+
+  //===========================================================================
+  // A tokenize_view is a C++20 view of the tokens of another view, as a
+  // tokenizer sees them. Its end() is std::default_sentinel, so it costs
+  // nothing, and its iterators find each token only when it is asked for:
+  // an increment passes over a token that was not looked at with the
+  // TokenizerFunction's skip member when it has one (see has_token_skip),
+  // and nothing after the last token that is used is scanned. So
+  //
+  //   line | boost::views::tokenize(sep) | std::views::take(3)
+  //
+  // reads the line up to the end of its third token, and no further.
+  //
+  // The iterators are forward iterators, which like token_iterator keep
+  // the current token and the TokenizerFunction in themselves.
+
+  template <std::ranges::view V, class TokenizerFunc,
+            class Type = std::basic_string<std::ranges::range_value_t<V> > >
+    requires std::ranges::forward_range<const V> &&
+             std::ranges::common_range<const V>
+  class tokenize_view
+    : public std::ranges::view_interface<tokenize_view<V, TokenizerFunc, Type> >
+  {
+    typedef std::ranges::iterator_t<const V> base_iterator;
+
+  public:
+    class iterator {
+      typedef tokenizer_detail::token_skipper<
+        has_token_skip<TokenizerFunc>::value> skipper;
+
+    public:
+      typedef std::forward_iterator_tag iterator_concept;
+      typedef std::forward_iterator_tag iterator_category;
+      typedef Type value_type;
+      typedef std::ptrdiff_t difference_type;
+
+      iterator() = default;
+
+      iterator(const TokenizerFunc& f, base_iterator first,
+               base_iterator last)
+        : f_(f), next_(first), end_(last), tok_(),
+          valid_(first != last), pending_(valid_)
+      {
+        f_.reset();
+      }
+
+      const Type& operator*() const {
+        find();
+        BOOST_ASSERT(valid_);
+        return tok_;
+      }
+
+      const Type* operator->() const { return &**this; }
+
+      iterator& operator++() {
+        if (pending_) {
+          valid_ = skipper::skip(f_, next_, end_, tok_);
+          BOOST_ASSERT(valid_);
+        }
+        pending_ = true;
+        return *this;
+      }
+
+      iterator operator++(int) {
+        iterator tmp(*this);
+        ++*this;
+        return tmp;
+      }
+
+      // The position in the underlying view after the current token once
+      // it was found, and before it until then.
+      base_iterator base() const { return next_; }
+
+      TokenizerFunc tokenizer_function() const { return f_; }
+
+      friend bool operator==(const iterator& a, const iterator& b) {
+        a.find();
+        b.find();
+        return (a.valid_ && b.valid_) ? a.next_ == b.next_
+                                      : a.valid_ == b.valid_;
+      }
+
+      friend bool operator==(const iterator& a, std::default_sentinel_t) {
+        a.find();
+        return !a.valid_;
+      }
+
+    private:
+      void find() const {
+        if (pending_) {
+          valid_ = f_(next_, end_, tok_);
+          pending_ = false;
+        }
+      }
+
+      mutable TokenizerFunc f_ = TokenizerFunc();
+      mutable base_iterator next_ = base_iterator();
+      base_iterator end_ = base_iterator();
+      mutable Type tok_ = Type();
+      mutable bool valid_ = false;
+      mutable bool pending_ = false;
+    };
+
+    tokenize_view()
+      requires std::default_initializable<V> &&
+               std::default_initializable<TokenizerFunc> = default;
+
+    explicit tokenize_view(V base, TokenizerFunc f = TokenizerFunc())
+      : base_(std::move(base)), f_(std::move(f)) { }
+
+    iterator begin() const {
+      return iterator(f_, std::ranges::begin(base_), std::ranges::end(base_));
+    }
+
+    std::default_sentinel_t end() const { return std::default_sentinel; }
+
+    V base() const { return base_; }
+    const TokenizerFunc& tokenizer_function() const { return f_; }
+
+  private:
+    V base_ = V();
+    TokenizerFunc f_ = TokenizerFunc();
+  };
+
+  template <class R, class TokenizerFunc>
+  tokenize_view(R&&, TokenizerFunc)
+    -> tokenize_view<std::views::all_t<R>, TokenizerFunc>;
+
+  namespace views {
+
+    template <class TokenizerFunc>
+    struct tokenize_closure {
+      TokenizerFunc f;
+
+      template <std::ranges::viewable_range R>
+      friend auto operator|(R&& r, const tokenize_closure& c) {
+        return tokenize_view(std::views::all(std::forward<R>(r)), c.f);
+      }
+    };
+
+    struct tokenize_fn {
+      template <std::ranges::viewable_range R, class TokenizerFunc>
+      auto operator()(R&& r, TokenizerFunc f) const {
+        return tokenize_view(std::views::all(std::forward<R>(r)),
+                             std::move(f));
+      }
+
+      template <class TokenizerFunc>
+      tokenize_closure<TokenizerFunc> operator()(TokenizerFunc f) const {
+        return tokenize_closure<TokenizerFunc>{std::move(f)};
+      }
+    };
+
+    // views::tokenize(r, f) and r | views::tokenize(f) are the tokenize_view
+    // of r with the TokenizerFunction f.
+    inline constexpr tokenize_fn tokenize{};
+
+  } // namespace views
+
+} // namespace boost
+
+#endif // BOOST_TOKENIZER_HAS_RANGES
+
+#endif
@@ -0,0 +1,211 @@
+// Boost tokenizer/typed_tokenizer.hpp  -------------------------------------//
+
+// Copyright 2026 Boost.Tokenizer contributors.
+
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// See http://www.boost.org/libs/tokenizer for documentation.
+
+#ifndef BOOST_TOKENIZER_TYPED_TOKENIZER_HPP_
+#define BOOST_TOKENIZER_TYPED_TOKENIZER_HPP_
+
+#include <boost/tokenizer/detail/config.hpp>
+
+#if defined(BOOST_TOKENIZER_HAS_FROM_CHARS)
+
+#include <array>
+#include <charconv>
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <boost/throw_exception.hpp>
+#include <boost/token_functions.hpp>
+
+namespace boost {
+
+  //===========================================================================
+  // The exception thrown by typed_tokenizer when a record does not match
+  // its schema. field() is the zero based index of the offending field.
+
+  struct typed_field_error : public std::runtime_error {
+    typed_field_error(std::size_t field, const std::string& what)
+      : std::runtime_error(what), field_(field) { }
+
+    std::size_t field() const { return field_; }
+
+  private:
+    std::size_t field_;
+  };
+
+  namespace tokenizer_detail {
+
+  // The token type typed_tokenizer passes to the TokenizerFunction. When the
+  // field is a plain range of the input it is only marked, with assign; the
+  // models that build tokens character by character, such as
+  // escaped_list_separator, append to a buffer instead.
+  class field_token {
+  public:
+    field_token() : first_(0), last_(0), buffered_(true) { }
+
+    void assign(const char* first, const char* last) {
+      first_ = first;
+      last_ = last;
+      buffered_ = false;
+    }
+
+    field_token& operator+=(char c) {
+      buffer_ += c;
+      buffered_ = true;
+      return *this;
+    }
+
+    // Empties the buffer for the next field, keeping its storage.
+    void clear() {
+      buffer_.clear();
+      buffered_ = true;
+    }
+
+    bool buffered() const { return buffered_; }
+    std::string& buffer() { return buffer_; }
+
+    std::string_view view() const {
+      if (buffered_)
+        return std::string_view(buffer_);
+      return std::string_view(first_, last_ - first_);
+    }
+
+  private:
+    const char* first_;
+    const char* last_;
+    std::string buffer_;
+    bool buffered_;
+  };
+
+  template <>
+  struct token_clear_traits<field_token> {
+    static void clear(field_token& t) { t.clear(); }
+  };
+
+  // Converts one field. Numbers are read with std::from_chars, which must
+  // consume the whole field. A string_view refers to the input if possible
+  // and otherwise to storage, which is owned by the typed_tokenizer.
+  template <class T>
+  void convert_field(field_token& tok, std::string&, T& value,
+                     std::size_t index)
+  {
+    static_assert(std::is_arithmetic<T>::value &&
+                  !std::is_same<T, bool>::value,
+                  "typed_tokenizer fields must be numbers, std::string or "
+                  "std::string_view");
+
+    std::string_view s = tok.view();
+    std::from_chars_result r =
+      std::from_chars(s.data(), s.data() + s.size(), value);
+    if (r.ec == std::errc::result_out_of_range)
+      BOOST_THROW_EXCEPTION(typed_field_error(index, "field out of range"));
+    if (r.ec != std::errc() || r.ptr != s.data() + s.size())
+      BOOST_THROW_EXCEPTION(typed_field_error(index,
+                                              "field is not a number"));
+  }
+
+  inline void convert_field(field_token& tok, std::string&,
+                            std::string& value, std::size_t)
+  {
+    value.assign(tok.view());
+  }
+
+  inline void convert_field(field_token& tok, std::string& storage,
+                            std::string_view& value, std::size_t)
+  {
+    if (tok.buffered()) {
+      storage.swap(tok.buffer());
+      value = storage;
+    }
+    else
+      value = tok.view();
+  }
+
+  } // namespace tokenizer_detail
+
+
+  //===========================================================================
+  // The typed_tokenizer class splits a record into fields with a
+  // TokenizerFunction and converts each field to the type the schema, a
+  // std::tuple, gives for it. Numbers are parsed with std::from_chars
+  // straight from the input, as soon as the TokenizerFunction has found the
+  // end of the field, so no token string is built for them.
+  //
+  //   typed_tokenizer<escaped_list_separator<char>,
+  //                   std::tuple<int, double, std::string_view> > t;
+  //   auto [id, price, name] = t.parse("42,9.95,widget");
+  //
+  // A field of type std::string_view refers to the record when the
+  // TokenizerFunction finds the field as a range of it (char_separator,
+  // offset_separator), and otherwise to storage in the typed_tokenizer;
+  // either way it stays valid until the next call to parse, as long as the
+  // record does. A record with too few or too many fields, or a field that
+  // is not a number of the right type, throws typed_field_error.
+  //
+  // Available with std::from_chars, for records of char.
+
+  template <class TokenizerFunc, class Schema>
+  class typed_tokenizer;
+
+  template <class TokenizerFunc, class... Fields>
+  class typed_tokenizer<TokenizerFunc, std::tuple<Fields...> > {
+  public:
+    typedef std::tuple<Fields...> value_type;
+
+    explicit typed_tokenizer(const TokenizerFunc& f = TokenizerFunc())
+      : f_(f) { }
+
+    void parse(std::string_view record, value_type& out) {
+      const char* next = record.data();
+      const char* end = next + record.size();
+      f_.reset();
+      parse_fields(next, end, out, std::index_sequence_for<Fields...>());
+      if (f_(next, end, tok_))
+        BOOST_THROW_EXCEPTION(typed_field_error(sizeof...(Fields),
+                                                "too many fields"));
+    }
+
+    value_type parse(std::string_view record) {
+      value_type out;
+      parse(record, out);
+      return out;
+    }
+
+    const TokenizerFunc& tokenizer_function() const { return f_; }
+
+  private:
+    template <std::size_t... I>
+    void parse_fields(const char*& next, const char* end, value_type& out,
+                      std::index_sequence<I...>) {
+      (parse_field(next, end, std::get<I>(out), I), ...);
+    }
+
+    template <class T>
+    void parse_field(const char*& next, const char* end, T& value,
+                     std::size_t index) {
+      if (!f_(next, end, tok_))
+        BOOST_THROW_EXCEPTION(typed_field_error(index, "too few fields"));
+      tokenizer_detail::convert_field(tok_, storage_[index], value, index);
+    }
+
+    TokenizerFunc f_;
+    tokenizer_detail::field_token tok_;
+    std::array<std::string, sizeof...(Fields)> storage_;
+  };
+
+} // namespace boost
+
+#endif // BOOST_TOKENIZER_HAS_FROM_CHARS
+
+#endif
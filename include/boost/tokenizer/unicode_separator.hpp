@@ -0,0 +1,453 @@
+// Boost tokenizer/unicode_separator.hpp  -----------------------------------//
+
+// Copyright 2026 Boost.Tokenizer contributors.
+
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// See http://www.boost.org/libs/tokenizer for documentation.
+
+#ifndef BOOST_TOKENIZER_UNICODE_SEPARATOR_HPP_
+#define BOOST_TOKENIZER_UNICODE_SEPARATOR_HPP_
+
+#include <vector>
+#include <string>
+#include <algorithm>
+#include <boost/config.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/token_functions.hpp>
+#include <boost/tokenizer/detail/unicode_tables.hpp>
+
+namespace boost {
+
+  namespace tokenizer_detail {
+
+  //===========================================================================
+  // Decoders for the encoding implied by the size of the character type:
+  // UTF-8 for char, UTF-16 for 16 bit and UTF-32 for 32 bit characters.
+  // Malformed sequences decode to invalid_code_point, which never matches a
+  // delimiter, so broken input ends up inside tokens instead of being lost.
+
+  const boost::uint32_t invalid_code_point = 0xFFFFFFFFu;
+
+  template <int N>
+  struct utf_decoder;
+
+  template <>
+  struct utf_decoder<1> {
+    template <class Char>
+    static boost::uint32_t unit(Char c) {
+      return static_cast<unsigned char>(c);
+    }
+
+    template <class Iterator>
+    static boost::uint32_t decode(Iterator& next, Iterator end) {
+      boost::uint32_t lead = unit(*next);
+      ++next;
+      if (lead < 0x80)
+        return lead;
+
+      int n;
+      boost::uint32_t cp, min;
+      if ((lead & 0xE0) == 0xC0) { n = 1; cp = lead & 0x1F; min = 0x80; }
+      else if ((lead & 0xF0) == 0xE0) { n = 2; cp = lead & 0x0F; min = 0x800; }
+      else if ((lead & 0xF8) == 0xF0) { n = 3; cp = lead & 0x07; min = 0x10000; }
+      else
+        return invalid_code_point;
+
+      // Only consume bytes that really are continuation bytes, so that a
+      // truncated sequence does not swallow the following character.
+      for (; n > 0; --n) {
+        if (next == end)
+          return invalid_code_point;
+        boost::uint32_t c = unit(*next);
+        if ((c & 0xC0) != 0x80)
+          return invalid_code_point;
+        cp = (cp << 6) | (c & 0x3F);
+        ++next;
+      }
+      if (cp < min || cp > 0x10FFFF || (cp >= 0xD800 && cp <= 0xDFFF))
+        return invalid_code_point;
+      return cp;
+    }
+
+    // Whether the sequence at next is cut short by end, so that more
+    // input could complete it.
+    template <class Iterator>
+    static bool truncated(Iterator next, Iterator end) {
+      boost::uint32_t lead = unit(*next);
+      int n;
+      if ((lead & 0xE0) == 0xC0) n = 1;
+      else if ((lead & 0xF0) == 0xE0) n = 2;
+      else if ((lead & 0xF8) == 0xF0) n = 3;
+      else
+        return false;
+      for (++next; n > 0; --n, ++next) {
+        if (next == end)
+          return true;
+        if ((unit(*next) & 0xC0) != 0x80)
+          return false;
+      }
+      return false;
+    }
+  };
+
+  template <>
+  struct utf_decoder<2> {
+    template <class Char>
+    static boost::uint32_t unit(Char c) {
+      return static_cast<boost::uint16_t>(c);
+    }
+
+    template <class Iterator>
+    static boost::uint32_t decode(Iterator& next, Iterator end) {
+      boost::uint32_t lead = unit(*next);
+      ++next;
+      if (lead < 0xD800 || lead > 0xDFFF)
+        return lead;
+      if (lead > 0xDBFF || next == end)
+        return invalid_code_point;
+      boost::uint32_t trail = unit(*next);
+      if (trail < 0xDC00 || trail > 0xDFFF)
+        return invalid_code_point;
+      ++next;
+      return 0x10000 + ((lead - 0xD800) << 10) + (trail - 0xDC00);
+    }
+
+    template <class Iterator>
+    static bool truncated(Iterator next, Iterator end) {
+      boost::uint32_t lead = unit(*next);
+      return lead >= 0xD800 && lead <= 0xDBFF && ++next == end;
+    }
+  };
+
+  template <>
+  struct utf_decoder<4> {
+    template <class Char>
+    static boost::uint32_t unit(Char c) {
+      return static_cast<boost::uint32_t>(c);
+    }
+
+    template <class Iterator>
+    static boost::uint32_t decode(Iterator& next, Iterator) {
+      boost::uint32_t cp = unit(*next);
+      ++next;
+      return cp <= 0x10FFFF ? cp : invalid_code_point;
+    }
+
+    template <class Iterator>
+    static bool truncated(Iterator, Iterator) { return false; }
+  };
+
+  } // namespace tokenizer_detail
+
+
+  //===========================================================================
+  // The unicode_separator class is a model of TokenizerFunction that works
+  // like char_separator, except that it reads code points instead of code
+  // units and classifies them with the Unicode character database instead of
+  // the C library. By default White_Space characters are dropped and
+  // punctuation and symbols are kept, which matches char_separator's use of
+  // isspace and ispunct in the ASCII range. Explicit delimiter lists are
+  // themselves encoded strings, so a multi-byte delimiter such as U+3001 can
+  // be given as a UTF-8 string.
+  //
+  // Characters below 0x80 are classified with a table, built as
+  // char_separator builds its own once the separator has found enough
+  // tokens, and kept on the heap, so that copies of the separator, such
+  // as the ones in token iterators, do not carry it. Runs of them inside
+  // a token are scanned without decoding, so mostly-ASCII text pays
+  // nothing for the Unicode support.
+  //
+  // Because a character has to be decoded before it is known to end a
+  // token, the iterators must be at least forward iterators.
+
+  template <typename Char,
+    typename Tr = BOOST_DEDUCED_TYPENAME std::basic_string<Char>::traits_type >
+  class unicode_separator
+  {
+    friend class tokenizer_detail::separator_state<unicode_separator>;
+    friend class tokenizer_detail::char_class_table<char>;
+    typedef tokenizer_detail::utf_decoder<sizeof(Char)> decoder;
+    typedef std::vector<boost::uint32_t> code_point_set;
+
+    enum char_class { data_char = 0, dropped_char = 1, kept_char = 2 };
+
+  public:
+    explicit
+    unicode_separator(const Char* dropped_delims,
+                      const Char* kept_delims = 0,
+                      empty_token_policy empty_tokens = drop_empty_tokens)
+      : m_use_punct(false),
+        m_use_space(false),
+        m_empty_tokens(empty_tokens),
+        m_output_done(false)
+    {
+      decode_set(dropped_delims, m_dropped_delims);
+      if (kept_delims)
+        decode_set(kept_delims, m_kept_delims);
+    }
+
+    // use Unicode punctuation for kept delimiters and White_Space for
+    // dropped.
+    explicit
+    unicode_separator()
+      : m_use_punct(true),
+        m_use_space(true),
+        m_empty_tokens(drop_empty_tokens),
+        m_output_done(false) { }
+
+    void reset() { m_output_done = false; }
+
+    template <typename ForwardIterator, typename Token>
+    bool operator()(ForwardIterator& next, ForwardIterator end, Token& tok)
+    {
+      tokenizer_detail::input_ends in;
+      return push(next, end, tok, in);
+    }
+
+    // The parsing loop of operator(), over input that may go on past end;
+    // see has_token_push. A character that end cuts in two is left for
+    // the next input, with in.cut_character().
+    template <typename ForwardIterator, typename Token, typename Input>
+    bool push(ForwardIterator& next, ForwardIterator end, Token& tok,
+              Input& in)
+    {
+      ForwardIterator after;
+      ForwardIterator start(next);
+
+      if (!in.in_token())
+        m_ascii.found_token(*this);
+
+      if (in.in_token()) {
+        // go on with the data characters of the token
+      }
+      else if (m_empty_tokens == drop_empty_tokens) {
+        // skip past all dropped delimiters
+        int cls;
+        for (;;) {
+          if (next == end)
+            return false;
+          if (in.more() && decoder::truncated(next, end)) {
+            in.cut_character();
+            return false;
+          }
+          cls = peek(next, end, after);
+          if (cls != dropped_char)
+            break;
+          next = after;
+        }
+
+        start = next;
+        next = after;
+        // a kept delimiter is a token on its own
+        if (cls != data_char) {
+          tok.assign(start, next);
+          return true;
+        }
+      }
+      else {
+        // m_empty_tokens == keep_empty_tokens
+
+        // Handle empty token at the end
+        if (next == end)
+        {
+          if (m_output_done == false && !in.more())
+          {
+            m_output_done = true;
+            tok.assign(start, next);
+            return true;
+          }
+          else
+            return false;
+        }
+
+        if (in.more() && decoder::truncated(next, end)) {
+          in.cut_character();
+          return false;
+        }
+        int cls = peek(next, end, after);
+        if (cls == kept_char) {
+          if (m_output_done == false)
+            m_output_done = true;
+          else {
+            next = after;
+            m_output_done = false;
+          }
+          tok.assign(start, next);
+          return true;
+        }
+        if (m_output_done == false && cls == dropped_char) {
+          m_output_done = true;
+          tok.assign(start, next);
+          return true;
+        }
+        if (cls == dropped_char)
+          start = next = after;
+        m_output_done = true;
+      }
+
+      if (scan_data(next, end, in.more())) {
+        if (next != end)
+          in.cut_character();
+        in.cut_token();
+        tok.assign(start, next);
+        return false;
+      }
+      tok.assign(start, next);
+      return true;
+    }
+
+    // Like operator(), but only finds the end of the token.
+    template <typename ForwardIterator>
+    bool skip(ForwardIterator& next, ForwardIterator end) {
+      tokenizer_detail::discard_token tok;
+      return (*this)(next, end, tok);
+    }
+
+  private:
+    code_point_set m_kept_delims;
+    code_point_set m_dropped_delims;
+    bool m_use_punct;
+    bool m_use_space;
+    empty_token_policy m_empty_tokens;
+    bool m_output_done;
+    tokenizer_detail::char_class_table<char> m_ascii;
+
+    static void decode_set(const Char* s, code_point_set& set)
+    {
+      const Char* end = s + Tr::length(s);
+      while (s != end)
+        set.push_back(decoder::decode(s, end));
+      std::sort(set.begin(), set.end());
+      set.erase(std::unique(set.begin(), set.end()), set.end());
+    }
+
+    // The class of a character below 0x80, looked up in m_ascii once that
+    // is built.
+    int ascii_class(boost::uint32_t u) const
+    {
+      unsigned char e;
+      if (m_ascii.lookup(static_cast<char>(u), e))
+        return e;
+      return classify_slow(u);
+    }
+
+    // The entries of m_ascii. Those of 0x80 and above are not looked up.
+    unsigned char classify(char c) const
+    {
+      boost::uint32_t u = static_cast<unsigned char>(c);
+      return static_cast<unsigned char>(u < 0x80 ? classify_slow(u)
+                                                 : data_char);
+    }
+
+    bool is_kept(boost::uint32_t cp) const
+    {
+      if (!m_kept_delims.empty())
+        return std::binary_search(m_kept_delims.begin(), m_kept_delims.end(), cp);
+      else if (m_use_punct)
+        return tokenizer_detail::in_code_point_ranges(
+          tokenizer_detail::unicode_tables<void>::punct,
+          tokenizer_detail::unicode_tables<void>::punct_size, cp);
+      else
+        return false;
+    }
+
+    bool is_dropped(boost::uint32_t cp) const
+    {
+      if (!m_dropped_delims.empty())
+        return std::binary_search(m_dropped_delims.begin(), m_dropped_delims.end(), cp);
+      else if (m_use_space)
+        return tokenizer_detail::in_code_point_ranges(
+          tokenizer_detail::unicode_tables<void>::space,
+          tokenizer_detail::unicode_tables<void>::space_size, cp);
+      else
+        return false;
+    }
+
+    // A character in both lists is dropped, except with keep_empty_tokens,
+    // where it is kept, as char_separator tests them in that order.
+    int classify_slow(boost::uint32_t cp) const
+    {
+      if (m_empty_tokens == keep_empty_tokens && is_kept(cp))
+        return kept_char;
+      if (is_dropped(cp))
+        return dropped_char;
+      if (is_kept(cp))
+        return kept_char;
+      return data_char;
+    }
+
+    // Classifies the character at next and sets after to the position
+    // following it.
+    template <typename ForwardIterator>
+    int peek(ForwardIterator next, ForwardIterator end,
+             ForwardIterator& after) const
+    {
+      boost::uint32_t u = decoder::unit(*next);
+      if (u < 0x80) {
+        after = ++next;
+        return ascii_class(u);
+      }
+      boost::uint32_t cp = decoder::decode(next, end);
+      after = next;
+      return cp == tokenizer_detail::invalid_code_point ?
+        static_cast<int>(data_char) : classify_slow(cp);
+    }
+
+    // Advances next to the first delimiter at or after next, and returns
+    // false. When more input may follow end, it returns true instead if
+    // the token reaches end, with next at end or at the start of a
+    // character that end cuts in two.
+    template <typename ForwardIterator>
+    bool scan_data(ForwardIterator& next, ForwardIterator end,
+                   bool more) const
+    {
+      ForwardIterator after;
+      while (next != end) {
+        boost::uint32_t u = decoder::unit(*next);
+        if (u < 0x80) {
+          if (ascii_class(u) != data_char)
+            return false;
+          ++next;
+        }
+        else {
+          if (more && decoder::truncated(next, end))
+            return true;
+          if (peek(next, end, after) != data_char)
+            return false;
+          next = after;
+        }
+      }
+      return more;
+    }
+  };
+
+  namespace tokenizer_detail {
+  template <class Char, class Tr>
+  class separator_state<unicode_separator<Char,Tr> > {
+    bool output_done_;
+  public:
+    explicit separator_state(const unicode_separator<Char,Tr>& f)
+      : output_done_(f.m_output_done) { }
+    void restore(unicode_separator<Char,Tr>& f) const {
+      f.m_output_done = output_done_;
+    }
+    static bool resumes_at_token(const unicode_separator<Char,Tr>& f) {
+      return f.m_empty_tokens == drop_empty_tokens;
+    }
+  };
+  } // namespace tokenizer_detail
+
+  template <class Char, class Tr>
+  struct has_token_skip<unicode_separator<Char,Tr> > : public true_type { };
+
+  template <class Char, class Tr>
+  struct has_token_push<unicode_separator<Char,Tr> > : public true_type { };
+
+  typedef unicode_separator<char> utf8_separator;
+
+} //namespace boost
+
+#endif
@@ -0,0 +1,129 @@
+// Boost tokenizer/word_tokenizer.hpp  --------------------------------------//
+
+// Copyright 2026 Boost.Tokenizer contributors.
+
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// See http://www.boost.org/libs/tokenizer for documentation.
+
+#ifndef BOOST_TOKENIZER_WORD_TOKENIZER_HPP_
+#define BOOST_TOKENIZER_WORD_TOKENIZER_HPP_
+
+#include <string>
+#include <boost/token_functions.hpp>
+#include <boost/tokenizer.hpp>
+#include <boost/tokenizer/token_view.hpp>
+
+namespace boost {
+
+  //===========================================================================
+  // The word_separator class is a model of TokenizerFunction that splits
+  // text at whitespace and punctuation, as isspace() and ispunct() classify
+  // it, and drops both. Its tokens are those of the deprecated
+  // char_delimiters_separator<Char>() that tokenizer<> uses by default, but
+  // it builds them with assign(first, last), so that it can return
+  // token_views. Like char_delimiters_separator, once it has found enough
+  // tokens it classifies single byte characters with a table, so with the
+  // C locale in effect when the table is built.
+
+  template <class Char,
+    class Tr = BOOST_DEDUCED_TYPENAME std::basic_string<Char>::traits_type >
+  class word_separator {
+  public:
+    word_separator() { }
+
+    void reset() { }
+
+    template <typename InputIterator, typename Token>
+    bool operator()(InputIterator& next, InputIterator end, Token& tok)
+    {
+      tokenizer_detail::input_ends in;
+      return push(next, end, tok, in);
+    }
+
+    // The parsing loop of operator(), over input that may go on past end;
+    // see has_token_push.
+    template <typename InputIterator, typename Token, typename Input>
+    bool push(InputIterator& next, InputIterator end, Token& tok, Input& in)
+    {
+      typedef tokenizer_detail::assign_or_plus_equal<
+        BOOST_DEDUCED_TYPENAME tokenizer_detail::get_iterator_category<
+          InputIterator
+        >::iterator_category
+      > assigner;
+
+      if (!in.in_token()) {
+        classes_.found_token(*this);
+        assigner::clear(tok);
+        for (; next != end && is_delimiter(*next); ++next) { }
+        if (next == end)
+          return false;
+      }
+      InputIterator start(next);
+      for (; next != end && !is_delimiter(*next); ++next)
+        assigner::plus_equal(tok, *next);
+      assigner::assign(start, next, tok);
+      if (next == end && in.more()) {
+        in.cut_token();
+        return false;
+      }
+      return true;
+    }
+
+    // Like operator(), but only finds the end of the token.
+    template <typename InputIterator>
+    bool skip(InputIterator& next, InputIterator end) {
+      tokenizer_detail::discard_token tok;
+      return (*this)(next, end, tok);
+    }
+
+  private:
+    friend class tokenizer_detail::char_class_table<Char>;
+    typedef tokenizer_detail::traits_extension<Tr> Traits;
+
+    unsigned char classify(Char c) const {
+      return Traits::isspace(c) || Traits::ispunct(c) ? 1 : 0;
+    }
+
+    bool is_delimiter(Char c) const {
+      unsigned char e;
+      if (classes_.lookup(c, e))
+        return e != 0;
+      return classify(c) != 0;
+    }
+
+    tokenizer_detail::char_class_table<Char> classes_;
+  };
+
+  template <class Char, class Tr>
+  struct has_token_skip<word_separator<Char,Tr> > : public true_type { };
+
+  template <class Char, class Tr>
+  struct has_token_push<word_separator<Char,Tr> > : public true_type { };
+
+  namespace tokenizer_detail {
+  // word_separator has no state at all.
+  template <class Char, class Tr>
+  class separator_state<word_separator<Char,Tr> > {
+  public:
+    explicit separator_state(const word_separator<Char,Tr>&) { }
+    void restore(word_separator<Char,Tr>&) const { }
+    static bool resumes_at_token(const word_separator<Char,Tr>&) {
+      return true;
+    }
+  };
+  } // namespace tokenizer_detail
+
+  // Tokenizers of std::string with the same tokens as tokenizer<>: one
+  // that returns them as strings, and one that returns views of the
+  // string, which copies nothing.
+  typedef tokenizer<word_separator<char> > word_tokenizer;
+  typedef tokenizer<word_separator<char>, std::string::const_iterator,
+                    token_view<std::string::const_iterator> >
+    word_view_tokenizer;
+
+} // namespace boost
+
+#endif
@@ -0,0 +1,121 @@
+// Boost tokenizer advance_tokens tests  ------------------------------------//
+
+// Copyright 2026 Boost.Tokenizer contributors.
+
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// See http://www.boost.org for updates, documentation, and revision history.
+
+#include <cstddef>
+#include <string>
+#include <boost/tokenizer.hpp>
+#include <boost/array.hpp>
+
+#include <boost/core/lightweight_test.hpp>
+
+namespace {
+
+  // A token that counts how often it is built.
+  int built = 0;
+
+  struct counted_token {
+    std::string s;
+    template <class Iterator>
+    void assign(Iterator b, Iterator e) { ++built; s.assign(b, e); }
+    counted_token& operator+=(char c) { s += c; return *this; }
+  };
+
+  // A TokenizerFunction that only works with std::string tokens, so it
+  // cannot be skipped and must fall back to building the tokens.
+  struct comma_separator {
+    void reset() { }
+    bool operator()(std::string::const_iterator& next,
+                    std::string::const_iterator end, std::string& tok) {
+      if (next == end)
+        return false;
+      std::string::const_iterator start = next;
+      while (next != end && *next != ',')
+        ++next;
+      tok.assign(start, next);
+      if (next != end)
+        ++next;
+      return true;
+    }
+  };
+
+  // Checks that skip(n) lands on the same token as n increments.
+  template <class Tok>
+  void check_skip(const Tok& t)
+  {
+    typedef typename Tok::iterator iterator;
+    std::size_t n = 0;
+    for (iterator it = t.begin(); it != t.end(); ++it, ++n) {
+      iterator s = t.begin();
+      s.skip(n);
+      BOOST_TEST(s != t.end());
+      BOOST_TEST(*s == *it);
+    }
+    iterator s = t.begin();
+    boost::advance_tokens(s, n);
+    BOOST_TEST(s == t.end());
+    s = t.begin();
+    boost::advance_tokens(s, n + 5);
+    BOOST_TEST(s.at_end());
+  }
+
+} // namespace
+
+int main()
+{
+  using namespace boost;
+
+  {
+    const std::string test_string = ";;Hello|world||-foo--bar;yow;baz|";
+    typedef tokenizer<char_separator<char> > Tok;
+    check_skip(Tok(test_string, char_separator<char>("-;|")));
+    check_skip(Tok(test_string,
+      char_separator<char>("-;", "|", boost::keep_empty_tokens)));
+  }
+
+  {
+    const std::string test_string = ",1,;2\\\";3\\;,4,5^\\,\'6,7\';";
+    typedef tokenizer<escaped_list_separator<char> > Tok;
+    check_skip(Tok(test_string,
+      escaped_list_separator<char>("\\^",",;","\"\'")));
+  }
+
+  {
+    const std::string test_string = "1225200101012002";
+    typedef tokenizer<offset_separator> Tok;
+    boost::array<int,3> offsets = {{2,2,4}};
+    check_skip(Tok(test_string,
+      offset_separator(offsets.begin(),offsets.end())));
+  }
+
+  {
+    const std::string test_string = "This,,is, a.test..";
+    check_skip(tokenizer<>(test_string));
+  }
+
+  {
+    const std::string test_string = "a,b,c,d";
+    check_skip(tokenizer<comma_separator>(test_string));
+  }
+
+  // Only the token landed on is built.
+  {
+    const std::string test_string = "f0,f1,f2,f3,f4,f5,f6,f7,f8,f9";
+    typedef tokenizer<char_separator<char>, std::string::const_iterator,
+                      counted_token> Tok;
+    Tok t(test_string, char_separator<char>(","));
+    Tok::iterator it = t.begin();
+    built = 0;
+    advance_tokens(it, 8);
+    BOOST_TEST(it->s == "f8");
+    BOOST_TEST(built == 1);
+  }
+
+  return boost::report_errors();
+}
@@ -0,0 +1,132 @@
+// Boost tokenizer ascii_word_separator tests  ------------------------------//
+
+// Copyright 2026 Boost.Tokenizer contributors.
+
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// See http://www.boost.org for updates, documentation, and revision history.
+
+#include <cstddef>
+#include <iterator>
+#include <list>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <boost/tokenizer.hpp>
+#include <boost/tokenizer/ascii_word_separator.hpp>
+#include <boost/tokenizer/count_tokens.hpp>
+#include <boost/tokenizer/token_view.hpp>
+
+#include <boost/core/lightweight_test.hpp>
+
+namespace {
+
+  const char spaces[] = " \t\n\v\f\r";
+  const char punctuation[] = "!\"#$%&'()*+,-./:;<=>?@[\\]^_`{|}~";
+
+  template <class TokenizerFunc, class Iterator>
+  std::vector<std::string> tokenized(Iterator first, Iterator last,
+                                     const TokenizerFunc& f)
+  {
+    boost::tokenizer<TokenizerFunc, Iterator> t(first, last, f);
+    return std::vector<std::string>(t.begin(), t.end());
+  }
+
+  // The words must be those of a char_separator with the same delimiters,
+  // for every kind of iterator.
+  void check_words(const std::string& s)
+  {
+    using boost::ascii_word_separator;
+    using boost::char_separator;
+
+    std::vector<std::string> kept = tokenized(s.begin(), s.end(),
+      char_separator<char>(spaces, punctuation));
+    std::vector<std::string> dropped = tokenized(s.begin(), s.end(),
+      char_separator<char>((std::string(spaces) + punctuation).c_str()));
+
+    ascii_word_separator keep_sep;
+    ascii_word_separator drop_sep(boost::drop_punctuation);
+    BOOST_TEST(tokenized(s.begin(), s.end(), keep_sep) == kept);
+    BOOST_TEST(tokenized(s.begin(), s.end(), drop_sep) == dropped);
+    BOOST_TEST(tokenized(s.data(), s.data() + s.size(), keep_sep) == kept);
+
+    std::list<char> l(s.begin(), s.end());
+    BOOST_TEST(tokenized(l.begin(), l.end(), keep_sep) == kept);
+    BOOST_TEST(tokenized(l.begin(), l.end(), drop_sep) == dropped);
+
+    std::istringstream in(s);
+    typedef std::istreambuf_iterator<char> stream_iterator;
+    BOOST_TEST(tokenized(stream_iterator(in), stream_iterator(), keep_sep)
+               == kept);
+
+    BOOST_TEST_EQ(boost::count_tokens(s.begin(), s.end(), keep_sep),
+                  kept.size());
+  }
+
+} // namespace
+
+int main()
+{
+  using namespace boost;
+
+  const char* inputs[] = {
+    "", " ", "word", "  two words  ", "Hello, world!", "a.b..c",
+    "tabs\tand\nnewlines\r\nand\vmore\f", "long_identifier_with_underscores",
+    "exactly8 exactly8exactly8 ", "        sixteen spaces before a word",
+    "caf\xC3\xA9 na\xC3\xAFve \xE2\x80\x94 dash", "ctl\x01\x7F" "chars",
+    "x", "!", "punctuation only: ,.;:!?"
+  };
+  const std::size_t n_inputs = sizeof(inputs) / sizeof(inputs[0]);
+  for (std::size_t i = 0; i < n_inputs; ++i)
+    check_words(inputs[i]);
+
+  // Random text, so that delimiters fall at every position of the blocks.
+  {
+    const char alphabet[] = "ab Z09 \t\n.,;-_\x01\x7F\x80\xFF";
+    unsigned seed = 12345;
+    for (int n = 0; n < 500; ++n) {
+      std::string s;
+      std::size_t length = n % 70;
+      for (std::size_t i = 0; i < length; ++i) {
+        seed = seed * 1103515245u + 12345u;
+        s += alphabet[(seed >> 16) % (sizeof(alphabet) - 1)];
+      }
+      check_words(s);
+    }
+  }
+
+  // Runs of word chars and of delimiters on both sides of the 16 chars
+  // after which they are passed over in blocks.
+  {
+    const char* runs[] = { "w", " ", ",", "\x80", "\t", ";" };
+    unsigned seed = 54321;
+    for (int n = 0; n < 300; ++n) {
+      std::string s;
+      for (int k = 0; k < 4; ++k) {
+        seed = seed * 1103515245u + 12345u;
+        const char* run = runs[(seed >> 16) % 6];
+        seed = seed * 1103515245u + 12345u;
+        s += std::string(10 + (seed >> 16) % 30, run[0]);
+      }
+      check_words(s);
+    }
+  }
+
+  // Views refer to the input.
+  {
+    const std::string s = "views  of, the input";
+    typedef std::string::const_iterator iterator;
+    tokenizer<ascii_word_separator, iterator, token_view<iterator> > t(s);
+    std::vector<token_view<iterator> > v(t.begin(), t.end());
+    BOOST_TEST_EQ(v.size(), 5u);
+    BOOST_TEST(v[0].begin() == s.begin());
+    BOOST_TEST_EQ(v[0].size(), 5u);
+    BOOST_TEST_EQ(v[2].str(), ",");
+    BOOST_TEST_EQ(v[4].str(), "input");
+    BOOST_TEST(v[4].end() == s.end());
+  }
+
+  return boost::report_errors();
+}
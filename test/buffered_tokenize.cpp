@@ -0,0 +1,202 @@
+// Boost tokenizer buffered_tokenize tests  ---------------------------------//
+
+// Copyright 2026 Boost.Tokenizer contributors.
+
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// See http://www.boost.org for updates, documentation, and revision history.
+
+#include <boost/tokenizer/buffered_tokenize.hpp>
+
+#include <cstddef>
+#include <iterator>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <boost/tokenizer.hpp>
+#include <boost/tokenizer/ascii_word_separator.hpp>
+#include <boost/tokenizer/unicode_separator.hpp>
+#include <boost/tokenizer/word_tokenizer.hpp>
+#include <boost/core/lightweight_test.hpp>
+
+namespace {
+
+  typedef std::vector<std::string> strings;
+
+  struct collect {
+    strings* out;
+
+    void operator()(const std::string& tok) const { out->push_back(tok); }
+  };
+
+  template <class TokenizerFunc>
+  strings tokenized(const std::string& s, const TokenizerFunc& f)
+  {
+    boost::tokenizer<TokenizerFunc> t(s, f);
+    return strings(t.begin(), t.end());
+  }
+
+  // The tokens from a stream, from istreambuf_iterators, and from the
+  // tokenizer over the string must agree for every size of window.
+  template <class TokenizerFunc>
+  void check(const std::string& s, const TokenizerFunc& f)
+  {
+    const strings expected = tokenized(s, f);
+    const std::size_t windows[] = { 1, 2, 3, 5, 8, 4096 };
+    for (std::size_t w = 0; w < sizeof(windows) / sizeof(windows[0]); ++w) {
+      strings from_stream;
+      collect sink = { &from_stream };
+      std::istringstream in(s);
+      boost::tokenize_buffered(in, f, sink, windows[w]);
+      BOOST_TEST(from_stream == expected);
+
+      strings from_iterators;
+      collect sink2 = { &from_iterators };
+      std::istringstream in2(s);
+      typedef std::istreambuf_iterator<char> input;
+      boost::tokenize_buffered(input(in2), input(), f, sink2, windows[w]);
+      BOOST_TEST(from_iterators == expected);
+    }
+  }
+
+  // Passes over all of its input, then throws, as a separator that runs
+  // out of memory for a long token might.
+  struct throwing_at_end {
+    int* calls;
+
+    explicit throwing_at_end(int* c) : calls(c) { }
+    void reset() { }
+
+    template <class Iterator, class Token>
+    bool operator()(Iterator& next, Iterator end, Token&) {
+      ++*calls;
+      next = end;
+      throw std::length_error("token too long");
+    }
+  };
+
+  // A stream buffer over a string that records the largest read asked of
+  // it, which is the size of the window of tokenize_buffered.
+  class recording_buf : public std::stringbuf {
+  public:
+    explicit recording_buf(const std::string& s)
+      : std::stringbuf(s), largest(0) { }
+
+    std::streamsize largest;
+
+  protected:
+    std::streamsize xsgetn(char* s, std::streamsize n) {
+      if (n > largest)
+        largest = n;
+      return std::stringbuf::xsgetn(s, n);
+    }
+  };
+
+} // namespace
+
+int main()
+{
+  using namespace boost;
+
+  const char* inputs[] = {
+    "", "a", ";", "|", ";;Hello|world||-foo--bar;yow;baz|", "|a|",
+    "x;|;x", ";|", "a long token that spans many small windows"
+  };
+  for (std::size_t i = 0; i < sizeof(inputs) / sizeof(inputs[0]); ++i) {
+    std::string s = inputs[i];
+    check(s, char_separator<char>("-;| "));
+    check(s, char_separator<char>("-; ", "|"));
+    check(s, char_separator<char>("-;", "|", keep_empty_tokens));
+    const int offsets[] = { 2, 3, 4 };
+    check(s, offset_separator(offsets, offsets + 3));
+    check(s, offset_separator(offsets, offsets + 3, false, false));
+  }
+
+  // The separators that drop delimiters before a token.
+  {
+    const char* words[] = {
+      "", " ", "  a", "This,,is, a.test..", "  long   gaps   between   words  "
+    };
+    for (std::size_t i = 0; i < sizeof(words) / sizeof(words[0]); ++i) {
+      std::string s = words[i];
+      check(s, char_delimiters_separator<char>());
+      check(s, char_delimiters_separator<char>(true));
+      check(s, word_separator<char>());
+      check(s, ascii_word_separator(keep_punctuation));
+      check(s, utf8_separator(" ", ","));
+    }
+  }
+
+  // The window does not grow to hold the delimiters before a token, only
+  // to hold a token longer than it.
+  {
+    const std::string s = std::string(1000, ' ') + "word" +
+                          std::string(1000, ' ') + "x";
+    std::string big(s);
+    big.replace(1000, 4, std::string(40, 'w'));
+    const std::string* inputs[] = { &s, &big };
+    const std::streamsize largest[] = { 16, 64 };
+    for (std::size_t i = 0; i < 2; ++i) {
+      strings out;
+      collect sink = { &out };
+      recording_buf buf(*inputs[i]);
+      std::istream in(&buf);
+      tokenize_buffered(in, char_separator<char>(" "), sink, 16);
+      BOOST_TEST(out == tokenized(*inputs[i], char_separator<char>(" ")));
+      BOOST_TEST(buf.largest <= largest[i]);
+    }
+  }
+
+  // Escapes and quotes cut by the end of the window.
+  {
+    std::string s = ",1,;2\\\";3\\;,4,5^\\,\'6,7\';";
+    check(s, escaped_list_separator<char>("\\^", ",;", "\"\'"));
+    check(std::string("Field 1,\"putting quotes around fields, allows "
+                      "commas\",Field 3\\n,"),
+          escaped_list_separator<char>());
+  }
+
+  // Errors that are not at the end of the window reach the caller.
+  {
+    strings out;
+    collect sink = { &out };
+    std::istringstream in("abc,de\\qfg,h");
+    BOOST_TEST_THROWS(tokenize_buffered(in, escaped_list_separator<char>(),
+                                        sink, 2),
+                      escaped_list_error);
+    BOOST_TEST_EQ(out.size(), 1u);
+    std::istringstream end("abc,de\\");
+    BOOST_TEST_THROWS(tokenize_buffered(end, escaped_list_separator<char>(),
+                                        sink, 2),
+                      escaped_list_error);
+  }
+
+  // Other errors at the end of the window are not taken for a token cut
+  // in two, and reach the caller from the first window.
+  {
+    int calls = 0;
+    strings out;
+    collect sink = { &out };
+    std::istringstream in("abcdefgh");
+    BOOST_TEST_THROWS(tokenize_buffered(in, throwing_at_end(&calls), sink,
+                                        2),
+                      std::length_error);
+    BOOST_TEST_EQ(calls, 1);
+  }
+
+  // Tokens from input iterators, with the token reused, are unchanged.
+  {
+    std::string s = "a much longer token;b;;c";
+    std::istringstream in(s);
+    typedef std::istreambuf_iterator<char> input;
+    tokenizer<char_separator<char>, input> t(input(in), input(),
+                                             char_separator<char>(";"));
+    BOOST_TEST(strings(t.begin(), t.end()) ==
+               tokenized(s, char_separator<char>(";")));
+  }
+
+  return boost::report_errors();
+}
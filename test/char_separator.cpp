@@ -0,0 +1,212 @@
+// Boost tokenizer char_separator tests  ------------------------------------//
+
+// Copyright 2026 Boost.Tokenizer contributors.
+
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// See http://www.boost.org for updates, documentation, and revision history.
+
+#include <boost/tokenizer.hpp>
+
+#include <cstddef>
+#include <list>
+#include <string>
+#include <vector>
+#include <boost/tokenizer/separator_spec.hpp>
+#include <boost/core/lightweight_test.hpp>
+
+namespace {
+
+  // The parsing loop of char_separator as it was written before it was
+  // driven by a table, one token per call.
+  template <class String>
+  struct reference_separator {
+    String dropped;
+    String kept;
+    bool keep_empty;
+    bool output_done;
+
+    bool is_dropped(typename String::value_type c) const {
+      return dropped.find(c) != String::npos;
+    }
+    bool is_kept(typename String::value_type c) const {
+      return kept.find(c) != String::npos;
+    }
+
+    template <class Iterator>
+    bool next(Iterator& next, Iterator end, String& tok) {
+      tok = String();
+      if (!keep_empty)
+        for (; next != end && is_dropped(*next); ++next) { }
+      Iterator start(next);
+      if (!keep_empty) {
+        if (next == end)
+          return false;
+        if (is_kept(*next))
+          ++next;
+        else
+          for (; next != end && !is_dropped(*next) && !is_kept(*next);
+               ++next) { }
+      }
+      else {
+        if (next == end) {
+          if (output_done)
+            return false;
+          output_done = true;
+          return true;
+        }
+        if (is_kept(*next)) {
+          if (!output_done)
+            output_done = true;
+          else {
+            ++next;
+            output_done = false;
+          }
+        }
+        else if (!output_done && is_dropped(*next))
+          output_done = true;
+        else {
+          if (is_dropped(*next))
+            start = ++next;
+          for (; next != end && !is_dropped(*next) && !is_kept(*next);
+               ++next) { }
+          output_done = true;
+        }
+      }
+      tok.assign(start, next);
+      return true;
+    }
+  };
+
+  template <class String>
+  std::vector<String> reference(const String& s, const String& dropped,
+                                const String& kept, bool keep_empty)
+  {
+    reference_separator<String> sep = { dropped, kept, keep_empty, false };
+    std::vector<String> v;
+    String tok;
+    typename String::const_iterator next = s.begin();
+    // As for a tokenizer, empty input has no tokens.
+    while (!s.empty() && sep.next(next, s.end(), tok))
+      v.push_back(tok);
+    return v;
+  }
+
+  template <class String, class Iterator, class TokenizerFunc>
+  std::vector<String> tokens(Iterator first, Iterator last,
+                             const TokenizerFunc& f)
+  {
+    boost::tokenizer<TokenizerFunc, Iterator, String> t(first, last, f);
+    return std::vector<String>(t.begin(), t.end());
+  }
+
+  // Every string of up to five characters over an alphabet of a token
+  // character, a dropped delimiter, a kept one, and one that is both.
+  template <class Char>
+  void check_all(const Char* alphabet, const Char* dropped,
+                 const Char* kept)
+  {
+    typedef std::basic_string<Char> string;
+    const boost::empty_token_policy modes[] = {
+      boost::drop_empty_tokens, boost::keep_empty_tokens
+    };
+    for (std::size_t m = 0; m < 2; ++m) {
+      boost::char_separator<Char> sep(dropped, kept, modes[m]);
+      const boost::char_separator_spec<Char> spec(dropped, kept, modes[m]);
+      boost::shared_separator<boost::char_separator_spec<Char> > shared(spec);
+      std::vector<string> inputs(1);
+      for (std::size_t len = 0; len <= 5; ++len) {
+        std::vector<string> longer;
+        for (std::size_t i = 0; i < inputs.size(); ++i) {
+          const string& s = inputs[i];
+          std::vector<string> expected = reference(
+            s, string(dropped), string(kept), m == 1);
+          BOOST_TEST(tokens<string>(s.begin(), s.end(), sep) == expected);
+          BOOST_TEST(tokens<string>(s.begin(), s.end(), shared) ==
+                     expected);
+          const std::list<Char> l(s.begin(), s.end());
+          BOOST_TEST(tokens<string>(l.begin(), l.end(), sep) == expected);
+          BOOST_TEST_EQ(sep.count(s.begin(), s.end()), expected.size());
+          for (const Char* a = alphabet; *a; ++a)
+            longer.push_back(s + *a);
+        }
+        inputs.swap(longer);
+      }
+    }
+  }
+
+} // namespace
+
+int main()
+{
+  using namespace boost;
+
+  check_all("a-|+", "-+", "|+");
+  check_all(L"a-|+\x3b1", L"-+\x3b1", L"|+");
+
+  // Kept delimiters are reported as such.
+  {
+    std::string s = "a||b-";
+    char_separator<char> sep("-", "|", keep_empty_tokens);
+    tokenizer<char_separator<char> > t(s, sep);
+    std::vector<std::string> v(t.begin(), t.end());
+    BOOST_TEST_EQ(v.size(), 6u);
+    BOOST_TEST(v[0] == "a" && v[1] == "|" && v[2] == "" && v[3] == "|" &&
+               v[4] == "b" && v[5] == "");
+  }
+
+  // The default separator, with all of its single byte classes.
+  {
+    std::string s;
+    for (int c = 1; c < 128; ++c)
+      s += char(c);
+    s += "  word, and.words ";
+    std::vector<std::string> expected =
+      reference(s, std::string(" \t\n\v\f\r"),
+                std::string("!\"#$%&'()*+,-./:;<=>?@[\\]^_`{|}~"), false);
+    BOOST_TEST(tokens<std::string>(s.begin(), s.end(),
+                                   char_separator<char>()) == expected);
+  }
+
+  // Long enough for the separator to build its table part way through.
+  // The bytes above 127, negative where char is signed, are classified
+  // by isspace() and ispunct() as the unsigned char values they hold.
+  {
+    std::string s;
+    for (int r = 0; r < 4; ++r)
+      for (int c = 1; c < 256; ++c) {
+        s += char(c);
+        s += "ab";
+      }
+    const empty_token_policy modes[] = { drop_empty_tokens,
+                                         keep_empty_tokens };
+    for (std::size_t m = 0; m < 2; ++m) {
+      char_separator<char> sep(" ,;-|", "|+.", modes[m]);
+      std::vector<std::string> expected =
+        reference(s, std::string(" ,;-|"), std::string("|+."), m == 1);
+      BOOST_TEST(tokens<std::string>(s.begin(), s.end(), sep) == expected);
+      BOOST_TEST_EQ(sep.count(s.begin(), s.end()), expected.size());
+
+      // A separator that has its table counts with it.
+      std::string tok;
+      const std::string& cs = s;
+      std::string::const_iterator next = cs.begin();
+      while (sep(next, cs.end(), tok)) { }
+      BOOST_TEST_EQ(sep.count(s.begin(), s.end()), expected.size());
+      char_separator<char> copy(sep);
+      copy.reset();
+      BOOST_TEST(tokens<std::string>(s.begin(), s.end(), copy) == expected);
+    }
+    std::vector<std::string> expected =
+      reference(s, std::string(" \t\n\v\f\r"),
+                std::string("!\"#$%&'()*+,-./:;<=>?@[\\]^_`{|}~"), false);
+    BOOST_TEST(tokens<std::string>(s.begin(), s.end(),
+                                   char_separator<char>()) == expected);
+    BOOST_TEST_EQ(char_separator<char>().count(s.begin(), s.end()),
+                  expected.size());
+  }
+
+  return boost::report_errors();
+}
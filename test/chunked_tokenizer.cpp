@@ -0,0 +1,222 @@
+// Boost tokenizer chunked_tokenizer tests  ---------------------------------//
+
+// Copyright 2026 Boost.Tokenizer contributors.
+
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// See http://www.boost.org for updates, documentation, and revision history.
+
+#include <boost/tokenizer/chunked_tokenizer.hpp>
+
+#include <boost/core/lightweight_test.hpp>
+
+#if defined(BOOST_TOKENIZER_HAS_COROUTINES)
+
+#include <cstddef>
+#include <string>
+#include <vector>
+#include <boost/array.hpp>
+#include <boost/tokenizer.hpp>
+#include <boost/tokenizer/word_tokenizer.hpp>
+
+namespace {
+
+  template <class TokenizerFunc>
+  std::vector<std::string> tokenized(const std::string& s,
+                                     const TokenizerFunc& f)
+  {
+    boost::tokenizer<TokenizerFunc> t(s, f);
+    return std::vector<std::string>(t.begin(), t.end());
+  }
+
+  template <class TokenizerFunc>
+  void drain(boost::chunked_tokenizer<TokenizerFunc>& t,
+             std::vector<std::string>& out)
+  {
+    std::string_view tok;
+    while (t.next(tok))
+      out.push_back(std::string(tok));
+  }
+
+  // Feeds s in chunks of the given sizes, the last one taking the rest.
+  template <class TokenizerFunc>
+  std::vector<std::string> chunked(const std::string& s,
+                                   const TokenizerFunc& f,
+                                   const std::vector<std::size_t>& cuts)
+  {
+    boost::chunked_tokenizer<TokenizerFunc> t(f);
+    std::vector<std::string> out;
+    std::size_t pos = 0;
+    for (std::size_t i = 0; i < cuts.size(); ++i) {
+      t.feed(std::string_view(s).substr(pos, cuts[i] - pos));
+      drain(t, out);
+      pos = cuts[i];
+    }
+    t.feed(std::string_view(s).substr(pos));
+    drain(t, out);
+    t.finish();
+    drain(t, out);
+    BOOST_TEST(t.done());
+    return out;
+  }
+
+  // Compares against the tokenizer for every split of s into one, two and
+  // three chunks, including empty ones.
+  template <class TokenizerFunc>
+  void check_chunked(const std::string& s, const TokenizerFunc& f)
+  {
+    std::vector<std::string> expected = tokenized(s, f);
+    BOOST_TEST(chunked(s, f, std::vector<std::size_t>()) == expected);
+    for (std::size_t i = 0; i <= s.size(); ++i) {
+      for (std::size_t j = i; j <= s.size(); ++j) {
+        std::vector<std::size_t> cuts;
+        cuts.push_back(i);
+        cuts.push_back(j);
+        BOOST_TEST(chunked(s, f, cuts) == expected);
+      }
+    }
+  }
+
+} // namespace
+
+int main()
+{
+  using namespace boost;
+
+  const char* inputs[] = {
+    "", "a", ";", "|", ";;Hello|world||-foo--bar;yow;baz|", "|a|",
+    "This,,is, a.test..", "  leading and trailing  ", "x;|;x", ";|"
+  };
+  const std::size_t n_inputs = sizeof(inputs) / sizeof(inputs[0]);
+
+  for (std::size_t i = 0; i < n_inputs; ++i) {
+    check_chunked(inputs[i], char_separator<char>("-;|"));
+    check_chunked(inputs[i], char_separator<char>("-;", "|"));
+    check_chunked(inputs[i],
+      char_separator<char>("-;", "|", boost::keep_empty_tokens));
+    check_chunked(inputs[i],
+      char_separator<char>("-;|", "|", boost::keep_empty_tokens));
+    check_chunked(inputs[i], char_separator<char>());
+    check_chunked(inputs[i], char_delimiters_separator<char>(true));
+    check_chunked(inputs[i], word_separator<char>());
+  }
+
+  const char* csv_inputs[] = {
+    "", ",", "a,b", "Field 1,\"embedded,comma\",quote \\\", escape \\\\",
+    "\"a,b\",\"c\"", "a,\"b,c", "a\\,b,"
+  };
+  const std::size_t n_csv = sizeof(csv_inputs) / sizeof(csv_inputs[0]);
+
+  for (std::size_t i = 0; i < n_csv; ++i)
+    check_chunked(csv_inputs[i], escaped_list_separator<char>());
+
+  check_chunked(",1,;2\\\";3\\;,4,5^\\,\'6,7\';",
+    escaped_list_separator<char>("\\^", ",;", "\"\'"));
+
+  {
+    boost::array<int,3> offsets = {{2,2,4}};
+    check_chunked("1225200101012002",
+      offset_separator(offsets.begin(), offsets.end(), false));
+    check_chunked("12252001010120",
+      offset_separator(offsets.begin(), offsets.end(), true, false));
+  }
+
+  // Tokens within a chunk are views into it.
+  {
+    std::string chunk = "ab cd";
+    chunked_tokenizer<char_separator<char> > t;
+    t.feed(chunk);
+    std::string_view tok;
+    BOOST_TEST(t.next(tok));
+    BOOST_TEST(tok == "ab");
+    BOOST_TEST(tok.data() == chunk.data());
+    BOOST_TEST(!t.next(tok));
+    BOOST_TEST(!t.done());
+    t.finish();
+    BOOST_TEST(t.next(tok));
+    BOOST_TEST(tok == "cd");
+    BOOST_TEST(!t.next(tok));
+    BOOST_TEST(t.done());
+  }
+
+  // A token that straddles two chunks is copied, and so outlives them.
+  {
+    std::string first = "ab,c", second = "d,e";
+    chunked_tokenizer<char_separator<char> > t(char_separator<char>(","));
+    std::string_view tok;
+    t.feed(first);
+    BOOST_TEST(t.next(tok));
+    BOOST_TEST(tok.data() == first.data());
+    BOOST_TEST(!t.next(tok));
+    t.feed(second);
+    BOOST_TEST(t.next(tok));
+    first.assign(first.size(), 'x');
+    second.assign(second.size(), 'x');
+    BOOST_TEST(tok == "cd");
+  }
+
+  // An escape at the end of a chunk waits for the next one; at the end of
+  // the input it is an error.
+  {
+    chunked_tokenizer<escaped_list_separator<char> > t;
+    std::string_view tok;
+    t.feed("a\\");
+    BOOST_TEST(!t.next(tok));
+    t.feed("n,b");
+    BOOST_TEST(t.next(tok));
+    BOOST_TEST(tok == "a\n");
+    t.finish();
+    BOOST_TEST(t.next(tok));
+    BOOST_TEST(tok == "b");
+
+    chunked_tokenizer<escaped_list_separator<char> > bad;
+    bad.feed("a,b\\");
+    BOOST_TEST(bad.next(tok));
+    BOOST_TEST(!bad.next(tok));
+    bad.finish();
+    BOOST_TEST_THROWS(bad.next(tok), escaped_list_error);
+  }
+
+  // A token that spans many chunks, each gone once it has been read.
+  {
+    chunked_tokenizer<char_separator<char> > t(char_separator<char>(","));
+    std::string_view tok;
+    for (int i = 0; i < 1000; ++i) {
+      std::string chunk = "abcd";
+      t.feed(chunk);
+      BOOST_TEST(!t.next(tok));
+    }
+    t.feed(",x");
+    BOOST_TEST(t.next(tok));
+    BOOST_TEST_EQ(tok.size(), 4000u);
+    BOOST_TEST(tok.substr(3996) == "abcd");
+  }
+
+  // The tokenizer can be moved while suspended.
+  {
+    chunked_tokenizer<char_separator<char> > t(char_separator<char>(","));
+    std::string_view tok;
+    t.feed("on");
+    BOOST_TEST(!t.next(tok));
+    chunked_tokenizer<char_separator<char> > u(std::move(t));
+    u.feed("e,two");
+    BOOST_TEST(u.next(tok));
+    BOOST_TEST(tok == "one");
+    u.finish();
+    BOOST_TEST(u.next(tok));
+    BOOST_TEST(tok == "two");
+  }
+
+  return boost::report_errors();
+}
+
+#else
+
+int main()
+{
+  return boost::report_errors();
+}
+
+#endif
@@ -0,0 +1,137 @@
+// Boost tokenizer constexpr_tokenize tests  --------------------------------//
+
+// Copyright 2026 Boost.Tokenizer contributors.
+
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// See http://www.boost.org for updates, documentation, and revision history.
+
+#include <boost/tokenizer/constexpr_tokenize.hpp>
+
+#include <boost/core/lightweight_test.hpp>
+
+#if defined(BOOST_TOKENIZER_HAS_STRING_VIEW)
+
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <boost/tokenizer.hpp>
+
+namespace {
+
+  using namespace std::string_view_literals;
+
+  constexpr auto flags = boost::make_token_array<8>("fast, safe,,small"sv,
+    boost::constexpr_char_separator<char>(", "));
+  static_assert(flags.size() == 3);
+  static_assert(flags[0] == "fast" && flags[1] == "safe" &&
+                flags[2] == "small");
+
+  constexpr auto kept = boost::make_token_array<8>("a|b||"sv,
+    boost::constexpr_char_separator<char>("", "|",
+                                          boost::keep_empty_tokens));
+  static_assert(kept.size() == 7);
+  static_assert(kept[1] == "|" && kept[4] == "" && kept[6] == "");
+
+  // Empty input has no tokens, even with keep_empty_tokens.
+  static_assert(boost::make_token_array<1>(""sv,
+    boost::constexpr_char_separator<char>(",", nullptr,
+                                          boost::keep_empty_tokens)).empty());
+  static_assert(boost::make_token_array<1>(""sv,
+    boost::constexpr_char_separator<char>(",")).empty());
+
+  constexpr int date_offsets[] = { 4, 2, 2 };
+  constexpr auto date = boost::make_token_array<3>("20261018"sv,
+    boost::constexpr_offset_separator<3>(date_offsets, false));
+  static_assert(date.size() == 3 && date[0] == "2026" && date[2] == "18");
+  static_assert(boost::make_token_array<1>(""sv,
+    boost::constexpr_offset_separator<3>(date_offsets, false)).empty());
+
+#if defined(BOOST_TOKENIZER_HAS_CLASS_TEMPLATE_ARGS)
+  constexpr auto cols = boost::tokenize<",">("a,b,,c");
+  static_assert(cols.size() == 3);
+  static_assert(cols[0] == "a" && cols[1] == "b" && cols[2] == "c");
+  static_assert(boost::tokenize<" ">("").empty());
+#endif
+
+  template <class TokenizerFunc>
+  std::vector<std::string> tokenized(const std::string& s,
+                                     const TokenizerFunc& f)
+  {
+    boost::tokenizer<TokenizerFunc> t(s, f);
+    return std::vector<std::string>(t.begin(), t.end());
+  }
+
+  template <class TokenizerFunc>
+  std::vector<std::string> token_array_of(std::string_view s,
+                                          const TokenizerFunc& f)
+  {
+    auto tokens = boost::make_token_array<64>(s, f);
+    return std::vector<std::string>(tokens.begin(), tokens.end());
+  }
+
+} // namespace
+
+int main()
+{
+  using namespace boost;
+
+  // At run time, the separators give the tokens of the ones they mirror.
+  const char* inputs[] = {
+    "", "a", ";", "|", ";;Hello|world||-foo--bar;yow;baz|", "|a|",
+    "x;|;x", ";|", "12252001", "122"
+  };
+  for (std::size_t i = 0; i < sizeof(inputs) / sizeof(inputs[0]); ++i) {
+    std::string s = inputs[i];
+    BOOST_TEST(tokenized(s, constexpr_char_separator<char>("-;|")) ==
+               tokenized(s, char_separator<char>("-;|")));
+    BOOST_TEST(tokenized(s, constexpr_char_separator<char>("-;", "|")) ==
+               tokenized(s, char_separator<char>("-;", "|")));
+    BOOST_TEST(tokenized(s, constexpr_char_separator<char>("-;", "|",
+                                                           keep_empty_tokens))
+               == tokenized(s, char_separator<char>("-;", "|",
+                                                     keep_empty_tokens)));
+    BOOST_TEST(token_array_of(s, constexpr_char_separator<char>("-;|")) ==
+               tokenized(s, char_separator<char>("-;|")));
+    BOOST_TEST(token_array_of(s, constexpr_char_separator<char>("-;", "|",
+                                                  keep_empty_tokens)) ==
+               tokenized(s, char_separator<char>("-;", "|",
+                                                 keep_empty_tokens)));
+
+    const int offsets[] = { 2, 2, 4 };
+    for (int flags = 0; flags < 4; ++flags) {
+      bool wrap = (flags & 1) != 0;
+      bool partial = (flags & 2) != 0;
+      BOOST_TEST(tokenized(s, constexpr_offset_separator<3>(offsets, wrap,
+                                                            partial)) ==
+                 tokenized(s, offset_separator(offsets, offsets + 3, wrap,
+                                               partial)));
+      BOOST_TEST(token_array_of(s, constexpr_offset_separator<3>(offsets,
+                                                   wrap, partial)) ==
+                 tokenized(s, offset_separator(offsets, offsets + 3, wrap,
+                                               partial)));
+    }
+  }
+
+  {
+    std::string_view s = "a b c d";
+    BOOST_TEST_THROWS(make_token_array<3>(s,
+                        constexpr_char_separator<char>(" ")),
+                      std::length_error);
+  }
+
+  return boost::report_errors();
+}
+
+#else
+
+int main()
+{
+  return boost::report_errors();
+}
+
+#endif
@@ -0,0 +1,115 @@
+// Boost tokenizer count_tokens tests  --------------------------------------//
+
+// Copyright 2026 Boost.Tokenizer contributors.
+
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// See http://www.boost.org for updates, documentation, and revision history.
+
+#include <cstddef>
+#include <iterator>
+#include <sstream>
+#include <string>
+#include <boost/tokenizer.hpp>
+#include <boost/tokenizer/count_tokens.hpp>
+#include <boost/tokenizer/unicode_separator.hpp>
+#include <boost/array.hpp>
+
+#include <boost/core/lightweight_test.hpp>
+
+namespace {
+
+  template <class TokenizerFunc>
+  std::ptrdiff_t tokenized(const std::string& s, const TokenizerFunc& f)
+  {
+    boost::tokenizer<TokenizerFunc> t(s, f);
+    return std::distance(t.begin(), t.end());
+  }
+
+  template <class TokenizerFunc>
+  void check_count(const std::string& s, const TokenizerFunc& f)
+  {
+    BOOST_TEST_EQ(static_cast<std::ptrdiff_t>(boost::count_tokens(s, f)),
+                  tokenized(s, f));
+  }
+
+  // Runs the check on a string and on a long repetition of it, so that
+  // char_separator takes both the direct and the table driven path.
+  template <class TokenizerFunc>
+  void check_counts(const std::string& s, const TokenizerFunc& f)
+  {
+    check_count(s, f);
+    std::string long_string;
+    for (int i = 0; i < 40; ++i)
+      long_string += s;
+    check_count(long_string, f);
+  }
+
+} // namespace
+
+int main()
+{
+  using namespace boost;
+
+  const char* inputs[] = {
+    "", "a", ";", "|", ";;Hello|world||-foo--bar;yow;baz|", "|a|",
+    "This,,is, a.test..", "  leading and trailing  ", "x;|;x", ";|",
+    // Bytes above 127, which the tables take as unsigned char.
+    "caf\xe9 na\xefve;\xa0|\xff\x80;x\xff"
+  };
+  const std::size_t n_inputs = sizeof(inputs) / sizeof(inputs[0]);
+
+  for (std::size_t i = 0; i < n_inputs; ++i) {
+    check_counts(inputs[i], char_separator<char>("\xa0;", "\xff|"));
+    check_counts(inputs[i],
+      char_separator<char>("\xa0;", "\xff|", boost::keep_empty_tokens));
+    check_counts(inputs[i], char_separator<char>("-;|"));
+    check_counts(inputs[i], char_separator<char>("-;", "|"));
+    check_counts(inputs[i],
+      char_separator<char>("-;", "|", boost::keep_empty_tokens));
+    // '|' is both dropped and kept.
+    check_counts(inputs[i], char_separator<char>("-;|", "|"));
+    check_counts(inputs[i],
+      char_separator<char>("-;|", "|", boost::keep_empty_tokens));
+    check_counts(inputs[i], char_separator<char>());
+    check_counts(inputs[i], char_delimiters_separator<char>());
+    check_counts(inputs[i], utf8_separator());
+  }
+
+  const char* csv_inputs[] = {
+    "", ",", "a,b", "Field 1,\"embedded,comma\",quote \\\", escape \\\\",
+    "\"a,b\",\"c\"", "a,\"b,c", "a\\,b,"
+  };
+  const std::size_t n_csv = sizeof(csv_inputs) / sizeof(csv_inputs[0]);
+
+  for (std::size_t i = 0; i < n_csv; ++i)
+    check_counts(csv_inputs[i], escaped_list_separator<char>());
+
+  check_counts(",1,;2\\\";3\\;,4,5^\\,\'6,7\';",
+    escaped_list_separator<char>("\\^", ",;", "\"\'"));
+
+  // Bad escapes are reported as by the tokenizer.
+  {
+    std::string s = "a,b\\";
+    BOOST_TEST_THROWS(count_tokens(s, escaped_list_separator<char>()),
+                      escaped_list_error);
+  }
+
+  {
+    boost::array<int,3> offsets = {{2,2,4}};
+    check_counts("1225200101012002",
+      offset_separator(offsets.begin(), offsets.end()));
+  }
+
+  // Input iterators.
+  {
+    std::istringstream in(";;Hello|world||-foo--bar;yow;baz|");
+    std::istreambuf_iterator<char> first(in), last;
+    BOOST_TEST_EQ(count_tokens(first, last,
+      char_separator<char>("-;", "|", boost::keep_empty_tokens)), 16u);
+  }
+
+  return boost::report_errors();
+}
@@ -0,0 +1,739 @@
+// Boost tokenizer differential tests  --------------------------------------//
+
+// Copyright 2026 Boost.Tokenizer contributors.
+
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// See http://www.boost.org for updates, documentation, and revision history.
+
+// Runs the faster separators and tokenizing paths of the library against
+// the TokenizerFunctions of token_functions.hpp that they must agree with,
+// on inputs and delimiter sets read from fuzz data, and checks that they
+// find the same tokens and fail on the same inputs. char_separator, which
+// is itself driven by a table, is checked against a copy of its parsing
+// loop as it was before.
+//
+// Built with BOOST_TOKENIZER_LIBFUZZER defined, this file is a libFuzzer
+// target (see fuzz/Jamfile.v2). Otherwise main() runs random cases:
+//
+//   differential [CASES [SEED]]
+//   differential --perf [BYTES] [--min-ratio R]
+//
+// --perf times each faster path against its reference on random text and
+// prints the throughput of one relative to the other. It fails when any
+// of them falls below R, 0.9 by default, which leaves room for timing
+// noise but not for a path that has become slower than the one it
+// replaced; --min-ratio 0 only reports. It also times short lines with a
+// separator and a tokenizer built for each, where the cost of setting up
+// a separator shows.
+
+#include <boost/tokenizer.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <list>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <boost/cstdint.hpp>
+#include <boost/tokenizer/ascii_word_separator.hpp>
+#include <boost/tokenizer/buffered_tokenize.hpp>
+#include <boost/tokenizer/chunked_tokenizer.hpp>
+#include <boost/tokenizer/constexpr_tokenize.hpp>
+#include <boost/tokenizer/count_tokens.hpp>
+#include <boost/tokenizer/lenient_escaped_list_separator.hpp>
+#include <boost/tokenizer/push_tokenizer.hpp>
+#include <boost/tokenizer/schema_separator.hpp>
+#include <boost/tokenizer/separator_spec.hpp>
+#include <boost/tokenizer/token_view.hpp>
+#include <boost/tokenizer/unicode_separator.hpp>
+#include <boost/tokenizer/word_tokenizer.hpp>
+#include <boost/core/lightweight_test.hpp>
+
+namespace {
+
+  typedef std::vector<std::string> strings;
+  typedef std::string::const_iterator iter;
+
+  // The tokens found, and whether an exception ended the search.
+  struct outcome {
+    strings tokens;
+    bool threw;
+
+    outcome() : threw(false) { }
+
+    bool operator==(const outcome& other) const {
+      return threw == other.threw && tokens == other.tokens;
+    }
+  };
+
+  const std::string* current_input = 0;
+
+  void print_escaped(const std::string& s) {
+    for (std::size_t i = 0; i < s.size(); ++i) {
+      unsigned char c = static_cast<unsigned char>(s[i]);
+      if (c < 0x20 || c >= 0x7F || c == '\\' || c == '"')
+        std::fprintf(stderr, "\\x%02X", c);
+      else
+        std::fputc(c, stderr);
+    }
+  }
+
+  void check(bool same, const char* what) {
+    if (same)
+      return;
+    std::fprintf(stderr, "differential: %s differs on \"", what);
+    if (current_input)
+      print_escaped(*current_input);
+    std::fprintf(stderr, "\"\n");
+    BOOST_ERROR(what);
+#ifdef BOOST_TOKENIZER_LIBFUZZER
+    std::abort();
+#endif
+  }
+
+  template <class Type>
+  std::string as_string(const Type& t) { return std::string(t); }
+
+  template <class Iterator>
+  std::string as_string(const boost::token_view<Iterator>& t) {
+    return std::string(t.begin(), t.end());
+  }
+
+  // The tokens of a tokenizer over [first, last) with tokens of type Type.
+  template <class Type, class TokenizerFunc, class Iterator>
+  outcome tokens(Iterator first, Iterator last, const TokenizerFunc& f) {
+    outcome r;
+    try {
+      boost::tokenizer<TokenizerFunc, Iterator, Type> t(first, last, f);
+      for (BOOST_DEDUCED_TYPENAME boost::tokenizer<
+             TokenizerFunc, Iterator, Type>::iterator it = t.begin();
+           it != t.end(); ++it)
+        r.tokens.push_back(as_string(*it));
+    }
+    catch (const std::runtime_error&) {
+      r.threw = true;
+    }
+    return r;
+  }
+
+  template <class TokenizerFunc>
+  outcome tokens(const std::string& s, const TokenizerFunc& f) {
+    return tokens<std::string>(s.begin(), s.end(), f);
+  }
+
+  struct collect {
+    strings* out;
+    void operator()(const std::string& tok) const { out->push_back(tok); }
+  };
+
+  template <class TokenizerFunc>
+  outcome buffered(const std::string& s, const TokenizerFunc& f,
+                   std::size_t lookahead) {
+    outcome r;
+    collect sink = { &r.tokens };
+    std::istringstream in(s);
+    try {
+      boost::tokenize_buffered(in, f, sink, lookahead);
+    }
+    catch (const std::runtime_error&) {
+      r.threw = true;
+    }
+    return r;
+  }
+
+  // The tokens of push_tokenizer over s cut into buffers of size
+  // characters, each a copy that is gone after the push.
+  template <class TokenizerFunc>
+  outcome pushed(const std::string& s, const TokenizerFunc& f,
+                 std::size_t size) {
+    outcome r;
+    boost::push_tokenizer<TokenizerFunc> t(f);
+    std::string tok;
+    try {
+      for (std::size_t pos = 0; pos < s.size(); pos += size) {
+        const std::vector<char> buffer(
+          s.begin() + pos, s.begin() + std::min(s.size(), pos + size));
+        std::vector<char>::const_iterator next = buffer.begin();
+        while (t.push(next, buffer.end(), tok))
+          r.tokens.push_back(tok);
+      }
+      while (t.finish(tok))
+        r.tokens.push_back(tok);
+    }
+    catch (const std::runtime_error&) {
+      r.threw = true;
+    }
+    return r;
+  }
+
+#if defined(BOOST_TOKENIZER_HAS_COROUTINES)
+  // The tokens of chunked_tokenizer over s fed in chunks of size
+  // characters.
+  template <class TokenizerFunc>
+  outcome chunked(const std::string& s, const TokenizerFunc& f,
+                  std::size_t size) {
+    outcome r;
+    boost::chunked_tokenizer<TokenizerFunc> t(f);
+    std::string_view tok;
+    try {
+      for (std::size_t pos = 0; pos < s.size(); pos += size) {
+        t.feed(std::string_view(s).substr(pos, size));
+        while (t.next(tok))
+          r.tokens.push_back(std::string(tok));
+      }
+      t.finish();
+      while (t.next(tok))
+        r.tokens.push_back(std::string(tok));
+    }
+    catch (const std::runtime_error&) {
+      r.threw = true;
+    }
+    return r;
+  }
+#endif
+
+  // push_tokenizer, and chunked_tokenizer where there are coroutines.
+  template <class TokenizerFunc>
+  void check_incremental(const std::string& s, const TokenizerFunc& f,
+                         std::size_t size, const outcome& expected,
+                         const char* push_what, const char* chunk_what) {
+    check(pushed(s, f, size) == expected, push_what);
+#if defined(BOOST_TOKENIZER_HAS_COROUTINES)
+    check(chunked(s, f, size) == expected, chunk_what);
+#else
+    (void)chunk_what;
+#endif
+  }
+
+  // The parsing loop of char_separator as it was written before it was
+  // driven by a table, as in test/char_separator.cpp, made a
+  // TokenizerFunction.
+  struct reference_separator {
+    std::string dropped;
+    std::string kept;
+    bool keep_empty;
+    bool output_done;
+
+    bool is_dropped(char c) const {
+      return dropped.find(c) != std::string::npos;
+    }
+    bool is_kept(char c) const {
+      return kept.find(c) != std::string::npos;
+    }
+
+    void reset() { output_done = false; }
+
+    template <class Iterator>
+    bool operator()(Iterator& next, Iterator end, std::string& tok) {
+      tok = std::string();
+      if (!keep_empty)
+        for (; next != end && is_dropped(*next); ++next) { }
+      Iterator start(next);
+      if (!keep_empty) {
+        if (next == end)
+          return false;
+        if (is_kept(*next))
+          ++next;
+        else
+          for (; next != end && !is_dropped(*next) && !is_kept(*next);
+               ++next) { }
+      }
+      else {
+        if (next == end) {
+          if (output_done)
+            return false;
+          output_done = true;
+          return true;
+        }
+        if (is_kept(*next)) {
+          if (!output_done)
+            output_done = true;
+          else {
+            ++next;
+            output_done = false;
+          }
+        }
+        else if (!output_done && is_dropped(*next))
+          output_done = true;
+        else {
+          if (is_dropped(*next))
+            start = ++next;
+          for (; next != end && !is_dropped(*next) && !is_kept(*next);
+               ++next) { }
+          output_done = true;
+        }
+      }
+      tok.assign(start, next);
+      return true;
+    }
+  };
+
+  reference_separator reference(const std::string& dropped,
+                                const std::string& kept, bool keep_empty) {
+    reference_separator sep = { dropped, kept, keep_empty, false };
+    return sep;
+  }
+
+  // The same text, one wchar_t per char. Wide characters have no table,
+  // so the delimiter lists are searched as they always were.
+  std::wstring widen(const std::string& s) {
+    std::wstring w;
+    for (std::size_t i = 0; i < s.size(); ++i)
+      w += static_cast<wchar_t>(static_cast<unsigned char>(s[i]));
+    return w;
+  }
+
+  outcome narrow(const std::vector<std::wstring>& v, bool threw) {
+    outcome r;
+    r.threw = threw;
+    for (std::size_t i = 0; i < v.size(); ++i) {
+      std::string s;
+      for (std::size_t j = 0; j < v[i].size(); ++j)
+        s += static_cast<char>(v[i][j]);
+      r.tokens.push_back(s);
+    }
+    return r;
+  }
+
+  bool is_ascii(const std::string& s) {
+    for (std::size_t i = 0; i < s.size(); ++i)
+      if (static_cast<unsigned char>(s[i]) >= 0x80)
+        return false;
+    return true;
+  }
+
+  const char ascii_space[] = " \t\n\v\f\r";
+  const char ascii_punct[] = "!\"#$%&'()*+,-./:;<=>?@[\\]^_`{|}~";
+
+
+  //===========================================================================
+  // The parameters of a case, read from the front of the fuzz data; the
+  // rest of it is the input. Delimiters come from a small alphabet, so
+  // that random input is likely to contain them.
+
+  class case_reader {
+  public:
+    case_reader(const boost::uint8_t* data, std::size_t size)
+      : p_(data), n_(size) { }
+
+    unsigned byte() {
+      if (n_ == 0)
+        return 0;
+      --n_;
+      return *p_++;
+    }
+
+    // Up to max distinct characters, at least min of them.
+    std::string delimiters(std::size_t min, std::size_t max) {
+      std::string s;
+      std::size_t n = min + byte() % (max - min + 1);
+      for (std::size_t i = 0; i < n; ++i) {
+        char c = alphabet()[byte() % alphabet_size];
+        if (s.find(c) == std::string::npos)
+          s += c;
+      }
+      return s;
+    }
+
+    std::string rest() {
+      std::string s(reinterpret_cast<const char*>(p_), n_);
+      n_ = 0;
+      return s;
+    }
+
+    static const char* alphabet() { return " ,;|\t\n\"\\'^-.a0\x80\xE9"; }
+    static const std::size_t alphabet_size = 16;
+
+  private:
+    const boost::uint8_t* p_;
+    std::size_t n_;
+  };
+
+
+  //===========================================================================
+  // The cases.
+
+  void char_separator_case(case_reader& in) {
+    using namespace boost;
+
+    const std::string dropped = in.delimiters(0, 3);
+    const std::string kept = in.delimiters(0, 2);
+    const empty_token_policy policy =
+      in.byte() & 1 ? keep_empty_tokens : drop_empty_tokens;
+    const std::size_t lookahead = 1 + in.byte() % 8;
+    const std::string s = in.rest();
+    current_input = &s;
+
+    const char_separator<char> sep(dropped.c_str(), kept.c_str(), policy);
+    const outcome expected =
+      tokens(s, reference(dropped, kept, policy == keep_empty_tokens));
+    check(tokens(s, sep) == expected, "char_separator");
+
+    // The byte table against the search of the delimiter lists.
+    {
+      const std::wstring ws = widen(s);
+      const std::wstring wd = widen(dropped);
+      const std::wstring wk = widen(kept);
+      typedef tokenizer<char_separator<wchar_t>, std::wstring::const_iterator,
+                        std::wstring> wtok;
+      wtok t(ws, char_separator<wchar_t>(wd.c_str(), wk.c_str(), policy));
+      check(narrow(std::vector<std::wstring>(t.begin(), t.end()), false) ==
+            expected, "char_separator<wchar_t>");
+    }
+
+    check(tokens<token_view<iter> >(s.begin(), s.end(), sep) == expected,
+          "char_separator with token_view");
+    const std::list<char> l(s.begin(), s.end());
+    check(tokens<std::string>(l.begin(), l.end(), sep) == expected,
+          "char_separator over a list");
+    check(sep.count(s.begin(), s.end()) == expected.tokens.size(),
+          "char_separator::count");
+    check(count_tokens(s.begin(), s.end(), sep) == expected.tokens.size(),
+          "count_tokens");
+    check(buffered(s, sep, lookahead) == expected, "tokenize_buffered");
+    check_incremental(s, sep, lookahead, expected, "push_tokenizer",
+                      "chunked_tokenizer");
+
+    const char_separator_spec<char> spec(dropped.c_str(), kept.c_str(),
+                                         policy);
+    check(tokens(s, shared_separator<char_separator_spec<char> >(spec)) ==
+          expected, "char_separator_spec");
+
+#if defined(BOOST_TOKENIZER_HAS_STRING_VIEW)
+    check(tokens<token_view<iter> >(s.begin(), s.end(),
+            constexpr_char_separator<char>(dropped.c_str(), kept.c_str(),
+                                           policy)) == expected,
+          "constexpr_char_separator");
+#endif
+
+    if (is_ascii(s) && is_ascii(dropped) && is_ascii(kept))
+      check(tokens(s, utf8_separator(dropped.c_str(), kept.c_str(),
+                                     policy)) == expected,
+            "unicode_separator");
+  }
+
+  void escaped_list_case(case_reader& in) {
+    using namespace boost;
+
+    const std::string e = in.delimiters(1, 2);
+    const std::string c = in.delimiters(1, 2);
+    const std::string q = in.delimiters(1, 2);
+    const std::size_t lookahead = 1 + in.byte() % 8;
+    const std::string s = in.rest();
+    current_input = &s;
+
+    const escaped_list_separator<char> sep(e, c, q);
+    const outcome expected = tokens(s, sep);
+
+    const std::list<char> l(s.begin(), s.end());
+    check(tokens<std::string>(l.begin(), l.end(), sep) == expected,
+          "escaped_list_separator over a list");
+    check(buffered(s, sep, lookahead) == expected,
+          "tokenize_buffered with escaped_list_separator");
+    check_incremental(s, sep, lookahead, expected,
+                      "push_tokenizer with escaped_list_separator",
+                      "chunked_tokenizer with escaped_list_separator");
+
+    const escaped_list_spec<char> spec(e, c, q);
+    check(tokens(s, shared_separator<escaped_list_spec<char> >(spec)) ==
+          expected, "escaped_list_spec");
+
+    if (!expected.threw) {
+      check(sep.count(s.begin(), s.end()) == expected.tokens.size(),
+            "escaped_list_separator::count");
+      check(tokens(s, lenient_escaped_list_separator<char>(e, c, q)) ==
+            expected, "lenient_escaped_list_separator");
+    }
+  }
+
+  void word_case(case_reader& in) {
+    using namespace boost;
+
+    const bool keep_punct = (in.byte() & 1) != 0;
+    const std::size_t size = 1 + in.byte() % 8;
+    const std::string s = in.rest();
+    current_input = &s;
+
+    // The default tokenizer<> and its replacements.
+    const outcome words = tokens(s, char_delimiters_separator<char>());
+    check(tokens(s, word_separator<char>()) == words, "word_separator");
+    check_incremental(s, char_delimiters_separator<char>(), size, words,
+                      "push_tokenizer with char_delimiters_separator",
+                      "chunked_tokenizer with char_delimiters_separator");
+    check_incremental(s, word_separator<char>(), size, words,
+                      "push_tokenizer with word_separator",
+                      "chunked_tokenizer with word_separator");
+    check(tokens<token_view<iter> >(s.begin(), s.end(),
+                                    word_separator<char>()) == words,
+          "word_view_tokenizer");
+
+    // ascii_word_separator, whose classes are fixed.
+    const std::string dropped =
+      std::string(ascii_space) + (keep_punct ? "" : ascii_punct);
+    const char_separator<char> sep(dropped.c_str(),
+                                   keep_punct ? ascii_punct : "");
+    const outcome expected = tokens(s, sep);
+    const ascii_word_separator ascii(keep_punct ? keep_punctuation
+                                                : drop_punctuation);
+    check(tokens<token_view<iter> >(s.begin(), s.end(), ascii) == expected,
+          "ascii_word_separator");
+    const std::list<char> l(s.begin(), s.end());
+    check(tokens<std::string>(l.begin(), l.end(), ascii) == expected,
+          "ascii_word_separator over a list");
+  }
+
+  void fixed_width_case(case_reader& in) {
+    using namespace boost;
+
+    std::vector<int> widths(1 + in.byte() % 3);
+    record_schema schema;
+    std::size_t record = 0;
+    for (std::size_t i = 0; i < widths.size(); ++i) {
+      widths[i] = 1 + static_cast<int>(in.byte() % 5);
+      schema.field(static_cast<std::size_t>(widths[i]));
+      record += static_cast<std::size_t>(widths[i]);
+    }
+    const std::size_t size = 1 + in.byte() % 8;
+    std::string s = in.rest();
+    s.resize(s.size() - s.size() % record);
+    current_input = &s;
+
+    const offset_separator offsets(widths.begin(), widths.end());
+    const outcome expected = tokens(s, offsets);
+    check_incremental(s, offsets, size, expected,
+                      "push_tokenizer with offset_separator",
+                      "chunked_tokenizer with offset_separator");
+    check(tokens<token_view<iter> >(s.begin(), s.end(),
+                                    schema_separator(schema)) == expected,
+          "schema_separator");
+    const std::list<char> l(s.begin(), s.end());
+    check(tokens<std::string>(l.begin(), l.end(), schema_separator(schema)) ==
+          expected, "schema_separator over a list");
+  }
+
+  void run_case(const boost::uint8_t* data, std::size_t size) {
+    case_reader in(data, size);
+    switch (in.byte() % 4) {
+    case 0: char_separator_case(in); break;
+    case 1: escaped_list_case(in); break;
+    case 2: word_case(in); break;
+    default: fixed_width_case(in); break;
+    }
+    current_input = 0;
+  }
+
+} // namespace
+
+extern "C" int LLVMFuzzerTestOneInput(const boost::uint8_t* data,
+                                      std::size_t size)
+{
+  run_case(data, size);
+  return 0;
+}
+
+#ifndef BOOST_TOKENIZER_LIBFUZZER
+
+namespace {
+
+  class random_source {
+  public:
+    explicit random_source(boost::uint32_t seed) : state_(seed) { }
+    unsigned next(unsigned n) {
+      state_ = state_ * 1103515245u + 12345u;
+      return (state_ >> 16) % n;
+    }
+  private:
+    boost::uint32_t state_;
+  };
+
+  // Fuzz data as libFuzzer might find it: parameter bytes, then text
+  // mostly from the alphabet of the delimiters.
+  std::string random_text(random_source& r, std::size_t size) {
+    std::string s;
+    for (std::size_t i = 0; i < size; ++i)
+      s += r.next(8) ? case_reader::alphabet()[
+                         r.next(case_reader::alphabet_size)]
+                     : static_cast<char>(r.next(256));
+    return s;
+  }
+
+  void run_random_cases(unsigned cases, boost::uint32_t seed) {
+    random_source r(seed);
+    for (unsigned i = 0; i < cases; ++i) {
+      std::string data;
+      for (unsigned j = 0; j < 12; ++j)
+        data += static_cast<char>(r.next(256));
+      data += random_text(r, r.next(40));
+      run_case(reinterpret_cast<const boost::uint8_t*>(data.data()),
+               data.size());
+    }
+  }
+
+
+  //===========================================================================
+  // The perf guard: the throughput of each faster path relative to its
+  // reference, the best of seven runs of each.
+
+  template <class Type, class TokenizerFunc>
+  double seconds(const std::string& s, const TokenizerFunc& f) {
+    double best = 0;
+    for (int run = 0; run < 7; ++run) {
+      std::clock_t start = std::clock();
+      std::size_t n = 0;
+      boost::tokenizer<TokenizerFunc, iter, Type> t(s.begin(), s.end(), f);
+      for (BOOST_DEDUCED_TYPENAME boost::tokenizer<
+             TokenizerFunc, iter, Type>::iterator it = t.begin();
+           it != t.end(); ++it)
+        n += as_string(*it).size() + 1;
+      double d = double(std::clock() - start) / CLOCKS_PER_SEC;
+      if (n == std::size_t(-1))
+        std::printf("\n");
+      if (run == 0 || d < best)
+        best = d;
+    }
+    return best > 0 ? best : 1e-9;
+  }
+
+  // A separator and a tokenizer built for each line, as a program that
+  // reads its input a line at a time does.
+  struct library_lines {
+    typedef boost::char_separator<char> separator;
+    static separator make() { return separator(" ,", ";|"); }
+  };
+
+  struct reference_lines {
+    typedef reference_separator separator;
+    static separator make() { return reference(" ,", ";|", false); }
+  };
+
+  template <class Lines>
+  double line_seconds(const strings& lines) {
+    typedef boost::tokenizer<BOOST_DEDUCED_TYPENAME Lines::separator> tok;
+    double best = 0;
+    for (int run = 0; run < 7; ++run) {
+      std::clock_t start = std::clock();
+      std::size_t n = 0;
+      for (std::size_t i = 0; i < lines.size(); ++i) {
+        tok t(lines[i], Lines::make());
+        for (BOOST_DEDUCED_TYPENAME tok::iterator it = t.begin();
+             it != t.end(); ++it)
+          n += it->size() + 1;
+      }
+      double d = double(std::clock() - start) / CLOCKS_PER_SEC;
+      if (n == std::size_t(-1))
+        std::printf("\n");
+      if (run == 0 || d < best)
+        best = d;
+    }
+    return best > 0 ? best : 1e-9;
+  }
+
+  struct guard {
+    double min_ratio;
+    bool failed;
+
+    void report(const char* what, double reference, double faster) {
+      double ratio = reference / faster;
+      bool bad = ratio < min_ratio;
+      std::printf("%-44s %6.2fx%s\n", what, ratio, bad ? "  (too slow)" : "");
+      failed = failed || bad;
+    }
+  };
+
+  int run_perf_guard(std::size_t size, double min_ratio) {
+    using namespace boost;
+
+    random_source r(2026);
+    const std::string text = random_text(r, size);
+    std::string words;
+    while (words.size() < size)
+      words += random_text(r, 1 + r.next(9)) + " ";
+    std::string fields;
+    while (fields.size() < size)
+      fields += std::string(1 + r.next(6), 'a') + (r.next(3) ? "," : ",,");
+
+    guard g = { min_ratio, false };
+    std::printf("throughput relative to the reference, %lu bytes\n\n",
+                static_cast<unsigned long>(size));
+
+    const char_separator<char> sep(" ,", ";|", keep_empty_tokens);
+    const double sep_time = seconds<std::string>(text, sep);
+    g.report("char_separator, token_view tokens",
+             sep_time, seconds<token_view<iter> >(text, sep));
+    const char_separator_spec<char> spec(" ,", ";|", keep_empty_tokens);
+    g.report("char_separator_spec", sep_time, seconds<std::string>(
+               text, shared_separator<char_separator_spec<char> >(spec)));
+    g.report("char_separator vs the old loop",
+             seconds<std::string>(text, reference(" ,", ";|", true)),
+             sep_time);
+
+    strings lines;
+    for (std::size_t n = 0; n < size; n += lines.back().size())
+      lines.push_back(words.substr(n, 20 + r.next(40)));
+    g.report("char_separator per line vs the old loop",
+             line_seconds<reference_lines>(lines),
+             line_seconds<library_lines>(lines));
+
+    const double words_time =
+      seconds<std::string>(words, char_delimiters_separator<char>());
+    g.report("word_separator vs char_delimiters_separator", words_time,
+             seconds<std::string>(words, word_separator<char>()));
+    g.report("word_view_tokenizer vs tokenizer<>", words_time,
+             seconds<token_view<iter> >(words, word_separator<char>()));
+    g.report("ascii_word_separator vs char_separator",
+             seconds<token_view<iter> >(
+               words, char_separator<char>(ascii_space, ascii_punct)),
+             seconds<token_view<iter> >(words, ascii_word_separator()));
+
+    const escaped_list_separator<char> csv;
+    const escaped_list_spec<char> csv_spec;
+    g.report("escaped_list_spec", seconds<std::string>(fields, csv),
+             seconds<std::string>(
+               fields, shared_separator<escaped_list_spec<char> >(csv_spec)));
+
+    const int widths[] = { 3, 5, 2 };
+    const std::string records = text.substr(0, size - size % 10);
+    g.report("schema_separator vs offset_separator",
+             seconds<token_view<iter> >(
+               records, offset_separator(widths, widths + 3)),
+             seconds<token_view<iter> >(
+               records, schema_separator(
+                 record_schema().field(3).field(5).field(2))));
+
+    return g.failed ? 1 : 0;
+  }
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+  if (argc > 1 && std::strcmp(argv[1], "--perf") == 0) {
+    std::size_t size = 1u << 22;
+    double min_ratio = 0.9;
+    for (int i = 2; i < argc; ++i) {
+      if (std::strcmp(argv[i], "--min-ratio") == 0 && i + 1 < argc)
+        min_ratio = std::atof(argv[++i]);
+      else
+        size = std::strtoul(argv[i], 0, 10);
+    }
+    return run_perf_guard(size, min_ratio);
+  }
+
+  unsigned cases = argc > 1 ? static_cast<unsigned>(std::atoi(argv[1]))
+                            : 20000;
+  boost::uint32_t seed = argc > 2 ?
+    static_cast<boost::uint32_t>(std::strtoul(argv[2], 0, 10)) : 1;
+  run_random_cases(cases, seed);
+
+  return boost::report_errors();
+}
+
+#endif
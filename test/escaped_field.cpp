@@ -0,0 +1,125 @@
+// Boost tokenizer escaped_field tests  -------------------------------------//
+
+// Copyright 2026 Boost.Tokenizer contributors.
+
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// See http://www.boost.org for updates, documentation, and revision history.
+
+#include <cstddef>
+#include <list>
+#include <string>
+#include <vector>
+#include <boost/tokenizer.hpp>
+#include <boost/tokenizer/separator_spec.hpp>
+
+#include <boost/core/lightweight_test.hpp>
+
+namespace {
+
+  typedef std::string::const_iterator iterator;
+  typedef boost::escaped_field<iterator> field;
+
+  // The values of the fields found in view mode must be the tokens.
+  template <class Separator>
+  void check_fields(const std::string& s, const Separator& sep)
+  {
+    boost::tokenizer<Separator> t(s, sep);
+    std::vector<std::string> expected(t.begin(), t.end());
+
+    boost::tokenizer<Separator, iterator, field> v(s, sep);
+    std::vector<std::string> values;
+    std::string value = "not empty";
+    for (typename boost::tokenizer<Separator, iterator, field>::iterator
+           it = v.begin(); it != v.end(); ++it) {
+      sep.unescape_into(*it, value);
+      values.push_back(value);
+      if (!it->needs_unescape())
+        BOOST_TEST(std::string(it->begin(), it->end()) == value);
+    }
+    BOOST_TEST(values == expected);
+  }
+
+} // namespace
+
+int main()
+{
+  using namespace boost;
+
+  const char* csv_inputs[] = {
+    "", ",", "a,b", "Field 1,\"embedded,comma\",quote \\\", escape \\\\",
+    "\"a,b\",\"c\"", "a,\"b,c", "a\\,b,", "\"\"", "\"a\"b", "a\"b\"",
+    "\"a\"\"b\"", "x,\"\",y"
+  };
+  const std::size_t n_csv = sizeof(csv_inputs) / sizeof(csv_inputs[0]);
+
+  for (std::size_t i = 0; i < n_csv; ++i)
+    check_fields(csv_inputs[i], escaped_list_separator<char>());
+
+  check_fields(",1,;2\\\";3\\;,4,5^\\,\'6,7\';",
+    escaped_list_separator<char>("\\^", ",;", "\"\'"));
+
+  // Only fields with escapes, or quotes other than around the whole
+  // field, need unescaping; the others are views of the input.
+  {
+    const std::string s = "plain,\"quoted, whole\",\"half\"quoted,esc\\n";
+    typedef tokenizer<escaped_list_separator<char>, iterator, field> Tok;
+    Tok t(s);
+    Tok::iterator it = t.begin();
+    BOOST_TEST(!it->needs_unescape());
+    BOOST_TEST(it->begin() == s.begin());
+    BOOST_TEST(std::string(it->begin(), it->end()) == "plain");
+    ++it;
+    BOOST_TEST(!it->needs_unescape());
+    BOOST_TEST(std::string(it->begin(), it->end()) == "quoted, whole");
+    BOOST_TEST(std::string(it->raw_begin(), it->raw_end()) ==
+               "\"quoted, whole\"");
+    ++it;
+    BOOST_TEST(it->needs_unescape());
+    BOOST_TEST(std::string(it->begin(), it->end()) == "\"half\"quoted");
+    ++it;
+    BOOST_TEST(it->needs_unescape());
+    std::string value;
+    t.begin().tokenizer_function().unescape_into(*it, value);
+    BOOST_TEST(value == "esc\n");
+    ++it;
+    BOOST_TEST(it == t.end());
+  }
+
+  // Bad escapes are reported while the fields are found.
+  {
+    const std::string s = "a,b\\x";
+    typedef tokenizer<escaped_list_separator<char>, iterator, field> Tok;
+    Tok t(s);
+    Tok::iterator it = t.begin();
+    BOOST_TEST_THROWS(++it, escaped_list_error);
+  }
+
+  // Specs have the view mode too, and any forward iterator will do.
+  {
+    const std::string text = "1,\"two, 2\",th\\\"ree";
+    std::list<char> s(text.begin(), text.end());
+    typedef std::list<char>::const_iterator list_iterator;
+    typedef escaped_list_spec<char> Spec;
+    typedef shared_separator<Spec> Sep;
+    Spec spec;
+    tokenizer<Sep, list_iterator, escaped_field<list_iterator> >
+      t(s, Sep(spec));
+    std::vector<std::string> values;
+    std::string value;
+    for (tokenizer<Sep, list_iterator,
+                   escaped_field<list_iterator> >::iterator it = t.begin();
+         it != t.end(); ++it) {
+      spec.unescape_into(*it, value);
+      values.push_back(value);
+    }
+    BOOST_TEST_EQ(values.size(), 3u);
+    BOOST_TEST_EQ(values[0], "1");
+    BOOST_TEST_EQ(values[1], "two, 2");
+    BOOST_TEST_EQ(values[2], "th\"ree");
+  }
+
+  return boost::report_errors();
+}
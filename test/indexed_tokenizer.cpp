@@ -0,0 +1,100 @@
+// Boost tokenizer indexed_tokenizer tests  ---------------------------------//
+
+// Copyright 2026 Boost.Tokenizer contributors.
+
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// See http://www.boost.org for updates, documentation, and revision history.
+
+#include <iterator>
+#include <string>
+#include <algorithm>
+#include <boost/tokenizer.hpp>
+#include <boost/tokenizer/indexed_tokenizer.hpp>
+#include <boost/array.hpp>
+
+#include <boost/core/lightweight_test.hpp>
+
+int main()
+{
+  using namespace boost;
+
+  {
+    const std::string test_string = ";;Hello|world||-foo--bar;yow;baz|";
+    std::string answer[] = { "", "", "Hello", "|", "world", "|", "", "|", "",
+                                            "foo", "", "bar", "yow", "baz", "|", "" };
+    typedef indexed_tokenizer<char_separator<char> > Tok;
+    char_separator<char> sep("-;", "|", boost::keep_empty_tokens);
+    Tok t(test_string, sep);
+    BOOST_TEST(t.size() == 16);
+    BOOST_TEST(std::distance(t.begin(), t.end()) == 16);
+    // Random access before sequential access, so that tokens are built
+    // from the saved separator state.
+    BOOST_TEST(t[14] == "|");
+    BOOST_TEST(t[5] == "|");
+    BOOST_TEST(t[9] == "foo");
+    BOOST_TEST(t.back() == "");
+    BOOST_TEST(std::equal(t.begin(), t.end(), answer));
+    BOOST_TEST(std::equal(t.rbegin(), t.rend(),
+                          std::reverse_iterator<std::string*>(answer + 16)));
+    BOOST_TEST(*(t.begin() + 12) == "yow");
+    BOOST_TEST(t.end() - t.begin() == 16);
+  }
+
+  {
+    const std::string test_string = ",1,;2\\\";3\\;,4,5^\\,\'6,7\';";
+    std::string answer[] = {"","1","","2\"","3;","4","5\\","6,7",""};
+    typedef indexed_tokenizer<escaped_list_separator<char> > Tok;
+    escaped_list_separator<char> sep("\\^",",;","\"\'");
+    Tok t(test_string,sep);
+    BOOST_TEST(t.size() == 9);
+    BOOST_TEST(t[8] == "");
+    BOOST_TEST(t[7] == "6,7");
+    BOOST_TEST(std::equal(t.begin(),t.end(),answer));
+  }
+
+  // A separator that throws part way leaves no index behind.
+  {
+    const std::string test_string = "a,b,c\\";
+    typedef indexed_tokenizer<escaped_list_separator<char> > Tok;
+    Tok t(test_string);
+    BOOST_TEST_THROWS(t.size(), escaped_list_error);
+    BOOST_TEST_THROWS(t.size(), escaped_list_error);
+    BOOST_TEST_THROWS(t[0], escaped_list_error);
+  }
+
+  {
+    const std::string test_string = "1225200101012002";
+    std::string answer[] = {"12","25","2001","01","01","2002"};
+    typedef indexed_tokenizer<offset_separator> Tok;
+    boost::array<int,3> offsets = {{2,2,4}};
+    offset_separator func(offsets.begin(),offsets.end());
+    Tok t(test_string,func);
+    BOOST_TEST(t.size() == 6);
+    BOOST_TEST(t[5] == "2002");
+    BOOST_TEST(t[4] == "01");
+    BOOST_TEST(std::equal(t.begin(),t.end(),answer));
+  }
+
+  // Same tokens as tokenizer<> and reuse with assign.
+  {
+    const std::string test_string = "This,,is, a.test..";
+    tokenizer<> plain(test_string);
+    indexed_tokenizer<> t(test_string);
+    BOOST_TEST(t.size() == 4);
+    BOOST_TEST(std::equal(plain.begin(), plain.end(), t.begin()));
+
+    const std::string other = "one two";
+    t.assign(other);
+    BOOST_TEST(t.size() == 2);
+    BOOST_TEST(t.at(1) == "two");
+
+    t.assign(std::string::const_iterator(), std::string::const_iterator());
+    BOOST_TEST(t.empty());
+    BOOST_TEST(t.begin() == t.end());
+  }
+
+  return boost::report_errors();
+}
@@ -0,0 +1,105 @@
+// Boost tokenizer instrumentation tests  -----------------------------------//
+
+// Copyright 2026 Boost.Tokenizer contributors.
+
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// See http://www.boost.org for updates, documentation, and revision history.
+
+#include <string>
+#include <algorithm>
+#include <boost/tokenizer.hpp>
+#include <boost/tokenizer/instrumentation.hpp>
+
+#include <boost/core/lightweight_test.hpp>
+
+int main()
+{
+  using namespace boost;
+
+  {
+    const std::string test_string = ";;Hello|world||-foo--bar;yow;baz|";
+    std::string answer[] = { "", "", "Hello", "|", "world", "|", "", "|", "",
+                                            "foo", "", "bar", "yow", "baz", "|", "" };
+    typedef instrumented_separator<char_separator<char> > Sep;
+    typedef tokenizer<Sep> Tok;
+    tokenizer_stats stats;
+    Sep sep(stats, char_separator<char>("-;", "|", boost::keep_empty_tokens));
+    Tok t(test_string, sep);
+    BOOST_TEST(std::equal(t.begin(), t.end(), answer));
+    BOOST_TEST_EQ(stats.tokens, 16u);
+    BOOST_TEST_EQ(stats.empty_tokens, 6u);
+    BOOST_TEST_EQ(stats.chars_scanned, test_string.size());
+    BOOST_TEST_EQ(stats.length_histogram[0], 6u);   // ""
+    BOOST_TEST_EQ(stats.length_histogram[1], 4u);   // "|"
+    BOOST_TEST_EQ(stats.length_histogram[2], 4u);   // "foo", "bar", ...
+    BOOST_TEST_EQ(stats.length_histogram[3], 2u);   // "Hello", "world"
+    BOOST_TEST_EQ(stats.escapes, 0u);
+  }
+
+  {
+    const std::string test_string = "Field 1,\"embedded,comma\",quote \\\", escape \\\\";
+    std::string answer[] = {"Field 1","embedded,comma","quote \""," escape \\"};
+    typedef instrumented_separator<escaped_list_separator<char> > Sep;
+    typedef tokenizer<Sep> Tok;
+    tokenizer_stats stats;
+    Tok t(test_string, Sep(stats));
+    BOOST_TEST(std::equal(t.begin(), t.end(), answer));
+    BOOST_TEST_EQ(stats.tokens, 4u);
+    BOOST_TEST_EQ(stats.escapes, 2u);
+    BOOST_TEST_EQ(stats.quotes, 2u);
+    BOOST_TEST_EQ(stats.chars_scanned, test_string.size());
+
+    tokenizer_stats total;
+    total.merge(stats);
+    total.merge(stats);
+    BOOST_TEST_EQ(total.tokens, 8u);
+    total.reset();
+    BOOST_TEST_EQ(total.tokens, 0u);
+  }
+
+  // The other escaped list models report the same events.
+  {
+    const std::string test_string = "Field 1,\"embedded,comma\",quote \\\", escape \\\\";
+    {
+      typedef instrumented_separator<lenient_escaped_list_separator<char> >
+        Sep;
+      tokenizer_stats stats;
+      tokenizer<Sep> t(test_string, Sep(stats));
+      BOOST_TEST_EQ(std::distance(t.begin(), t.end()), 4);
+      BOOST_TEST_EQ(stats.escapes, 2u);
+      BOOST_TEST_EQ(stats.quotes, 2u);
+    }
+    {
+      typedef shared_separator<escaped_list_spec<char> > Shared;
+      typedef instrumented_separator<Shared> Sep;
+      const escaped_list_spec<char> spec;
+      tokenizer_stats stats;
+      tokenizer<Sep> t(test_string, Sep(stats, Shared(spec)));
+      BOOST_TEST_EQ(std::distance(t.begin(), t.end()), 4);
+      BOOST_TEST_EQ(stats.escapes, 2u);
+      BOOST_TEST_EQ(stats.quotes, 2u);
+    }
+  }
+
+  // Disabled statistics do not change the tokens.
+  {
+    const std::string test_string = "This,,is, a.test..";
+    std::string answer[] = {"This","is","a","test"};
+    typedef instrumented_separator<char_delimiters_separator<char>,
+                                   null_tokenizer_stats> Sep;
+    null_tokenizer_stats stats;
+    tokenizer<Sep> t(test_string, Sep(stats));
+    BOOST_TEST(std::equal(t.begin(), t.end(), answer));
+  }
+
+  BOOST_TEST_EQ(tokenizer_stats::bucket(0), 0u);
+  BOOST_TEST_EQ(tokenizer_stats::bucket(1), 1u);
+  BOOST_TEST_EQ(tokenizer_stats::bucket(3), 2u);
+  BOOST_TEST_EQ(tokenizer_stats::bucket(std::size_t(1) << 20),
+                tokenizer_stats::histogram_size - 1);
+
+  return boost::report_errors();
+}
@@ -0,0 +1,137 @@
+// Boost tokenizer lenient_escaped_list_separator tests  --------------------//
+
+// Copyright 2026 Boost.Tokenizer contributors.
+
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// See http://www.boost.org for updates, documentation, and revision history.
+
+#include <cstddef>
+#include <list>
+#include <string>
+#include <utility>
+#include <vector>
+#include <boost/tokenizer.hpp>
+#include <boost/tokenizer/lenient_escaped_list_separator.hpp>
+
+#include <boost/core/lightweight_test.hpp>
+
+namespace {
+
+  typedef std::pair<boost::escaped_list_errc, std::size_t> error_record;
+
+  // Collects every error; copies of the separator share the vector.
+  struct collect_errors {
+    std::vector<error_record>* errors;
+    explicit collect_errors(std::vector<error_record>* e = 0) : errors(e) { }
+    void operator()(boost::escaped_list_errc code, std::size_t offset) const {
+      errors->push_back(error_record(code, offset));
+    }
+  };
+
+  template <class TokenizerFunc>
+  std::vector<std::string> tokenized(const std::string& s,
+                                     const TokenizerFunc& f)
+  {
+    boost::tokenizer<TokenizerFunc> t(s, f);
+    return std::vector<std::string>(t.begin(), t.end());
+  }
+
+} // namespace
+
+int main()
+{
+  using namespace boost;
+
+  typedef lenient_escaped_list_separator<char> Lenient;
+
+  // Without bad escapes, the fields are those of escaped_list_separator.
+  {
+    const char* inputs[] = {
+      "", ",", "a,b", "Field 1,\"embedded,comma\",quote \\\", escape \\\\",
+      "\"a,b\",\"c\"", "a,\"b,c", "a\\,b,", "a\\nb"
+    };
+    for (std::size_t i = 0; i < sizeof(inputs) / sizeof(inputs[0]); ++i)
+      BOOST_TEST(tokenized(inputs[i], Lenient()) ==
+                 tokenized(inputs[i], escaped_list_separator<char>()));
+    const std::string custom = ",1,;2\\\";3\\;,4,5^\\,\'6,7\';";
+    BOOST_TEST(tokenized(custom, Lenient("\\^", ",;", "\"\'")) ==
+               tokenized(custom,
+                 escaped_list_separator<char>("\\^", ",;", "\"\'")));
+  }
+
+  // Bad escapes are kept or skipped, and the fields after them are found.
+  {
+    const std::string s = "ok,bad\\x,\"q\\yq\",end\\";
+    std::vector<std::string> kept = tokenized(s, Lenient());
+    BOOST_TEST_EQ(kept.size(), 4u);
+    BOOST_TEST_EQ(kept[0], "ok");
+    BOOST_TEST_EQ(kept[1], "bad\\x");
+    BOOST_TEST_EQ(kept[2], "q\\yq");
+    BOOST_TEST_EQ(kept[3], "end\\");
+
+    std::vector<std::string> skipped =
+      tokenized(s, Lenient('\\', ',', '\"', skip_bad_escapes));
+    BOOST_TEST_EQ(skipped.size(), 4u);
+    BOOST_TEST_EQ(skipped[1], "bad");
+    BOOST_TEST_EQ(skipped[2], "qq");
+    BOOST_TEST_EQ(skipped[3], "end");
+
+    BOOST_TEST_THROWS(tokenized(s, escaped_list_separator<char>()),
+                      escaped_list_error);
+  }
+
+  // Each field reports its first error and where it is.
+  {
+    const std::string s = "a,b\\x\\y,c\n,\\";
+    tokenizer<Lenient> t(s);
+    tokenizer<Lenient>::iterator it = t.begin();
+    BOOST_TEST_EQ(*it, "a");
+    BOOST_TEST(it.tokenizer_function().error() == no_escape_error);
+    BOOST_TEST_EQ(it.tokenizer_function().field_offset(), 0u);
+    ++it;
+    BOOST_TEST(it.tokenizer_function().error() == unknown_escape);
+    BOOST_TEST_EQ(it.tokenizer_function().error_offset(), 3u);
+    BOOST_TEST_EQ(it.tokenizer_function().field_offset(), 2u);
+    ++it;
+    BOOST_TEST_EQ(*it, "c\n");
+    BOOST_TEST(it.tokenizer_function().error() == no_escape_error);
+    ++it;
+    BOOST_TEST(it.tokenizer_function().error() == escape_at_end);
+    BOOST_TEST_EQ(it.tokenizer_function().error_offset(), 11u);
+    ++it;
+    BOOST_TEST(it == t.end());
+  }
+
+  // The handler sees every error each time a field is parsed, with offsets
+  // from the start of the input, also for iterators that are not random
+  // access.
+  {
+    typedef lenient_escaped_list_separator<char,
+      std::char_traits<char>, collect_errors> Handled;
+    std::vector<error_record> errors;
+    const std::string text = "\\q,\"x\\z\\\\\",y\\";
+    std::list<char> s(text.begin(), text.end());
+    typedef std::list<char>::const_iterator iterator;
+    Handled sep('\\', ',', '\"', skip_bad_escapes, collect_errors(&errors));
+    tokenizer<Handled, iterator> t(s.begin(), s.end(), sep);
+    std::vector<std::string> v;
+    for (tokenizer<Handled, iterator>::iterator it = t.begin();
+         it != t.end(); ++it)
+      v.push_back(*it);
+    BOOST_TEST_EQ(v.size(), 3u);
+    BOOST_TEST_EQ(v[0], "");
+    BOOST_TEST_EQ(v[1], "x\\");
+    BOOST_TEST_EQ(v[2], "y");
+    BOOST_TEST_EQ(errors.size(), 3u);
+    if (errors.size() == 3u) {
+      BOOST_TEST(errors[0] == error_record(unknown_escape, 0));
+      BOOST_TEST(errors[1] == error_record(unknown_escape, 5));
+      BOOST_TEST(errors[2] == error_record(escape_at_end, 12));
+    }
+  }
+
+  return boost::report_errors();
+}
@@ -0,0 +1,151 @@
+// Boost tokenizer line_separator tests  ------------------------------------//
+
+// Copyright 2026 Boost.Tokenizer contributors.
+
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// See http://www.boost.org for updates, documentation, and revision history.
+
+#include <cstddef>
+#include <iterator>
+#include <list>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <boost/tokenizer.hpp>
+#include <boost/tokenizer/count_tokens.hpp>
+#include <boost/tokenizer/line_separator.hpp>
+
+#include <boost/core/lightweight_test.hpp>
+
+namespace {
+
+  typedef boost::line_separator<char> lines;
+
+  std::vector<std::string> split(const std::string& s, const lines& sep)
+  {
+    boost::tokenizer<lines> t(s, sep);
+    return std::vector<std::string>(t.begin(), t.end());
+  }
+
+  // Contiguous, forward and input iterators must all give the same lines.
+  void check_lines(const std::string& s, const lines& sep)
+  {
+    std::vector<std::string> expected = split(s, sep);
+
+    std::list<char> l(s.begin(), s.end());
+    boost::tokenizer<lines, std::list<char>::const_iterator>
+      lt(l.begin(), l.end(), sep);
+    BOOST_TEST(std::vector<std::string>(lt.begin(), lt.end()) == expected);
+
+    std::istringstream in(s);
+    typedef std::istreambuf_iterator<char> stream_iterator;
+    boost::tokenizer<lines, stream_iterator>
+      st(stream_iterator(in), stream_iterator(), sep);
+    BOOST_TEST(std::vector<std::string>(st.begin(), st.end()) == expected);
+
+    boost::tokenizer<lines, const char*>
+      pt(s.data(), s.data() + s.size(), sep);
+    BOOST_TEST(std::vector<std::string>(pt.begin(), pt.end()) == expected);
+  }
+
+} // namespace
+
+int main()
+{
+  using namespace boost;
+
+  {
+    std::vector<std::string> v = split("one\ntwo\r\n\nfour\n", lines());
+    BOOST_TEST_EQ(v.size(), 4u);
+    BOOST_TEST_EQ(v[0], "one");
+    BOOST_TEST_EQ(v[1], "two");
+    BOOST_TEST_EQ(v[2], "");
+    BOOST_TEST_EQ(v[3], "four");
+  }
+
+  // No newline at the end, and no lines at all.
+  BOOST_TEST(split("last", lines()) == std::vector<std::string>(1, "last"));
+  BOOST_TEST(split("", lines()).empty());
+  BOOST_TEST(split("\n", lines()) == std::vector<std::string>(1, ""));
+  BOOST_TEST(split("\n", lines(drop_empty_tokens)).empty());
+
+  {
+    std::vector<std::string> v =
+      split("\r\na\r\r\n\n\nb\r", lines(drop_empty_tokens));
+    BOOST_TEST_EQ(v.size(), 2u);
+    BOOST_TEST_EQ(v[0], "a\r");
+    BOOST_TEST_EQ(v[1], "b");
+  }
+
+  {
+    std::vector<std::string> v =
+      split("a\r\nb\r", lines(keep_empty_tokens, false));
+    BOOST_TEST_EQ(v.size(), 2u);
+    BOOST_TEST_EQ(v[0], "a\r");
+    BOOST_TEST_EQ(v[1], "b\r");
+  }
+
+  const char* inputs[] = {
+    "", "\n", "\n\n", "a", "a\n", "a\nb", "\r", "\r\n", "\r\r\n", "a\rb\n",
+    "x\r\n\r\ny\r\n", "\n\na\n\n", "a\r\n\rb\r"
+  };
+  const std::size_t n_inputs = sizeof(inputs) / sizeof(inputs[0]);
+  for (std::size_t i = 0; i < n_inputs; ++i) {
+    check_lines(inputs[i], lines());
+    check_lines(inputs[i], lines(drop_empty_tokens));
+    check_lines(inputs[i], lines(keep_empty_tokens, false));
+  }
+
+  // The guard allows lines up to the maximum, not counting a stripped CR.
+  {
+    lines sep(keep_empty_tokens, true, 3);
+    BOOST_TEST(split("abc\r\nde", sep).size() == 2u);
+    BOOST_TEST_THROWS(split("abc\nabcd\n", sep), line_length_error);
+
+    std::istringstream in("ab\nabcdefgh");
+    typedef std::istreambuf_iterator<char> stream_iterator;
+    tokenizer<lines, stream_iterator>
+      t(stream_iterator(in), stream_iterator(), sep);
+    tokenizer<lines, stream_iterator>::iterator it = t.begin();
+    BOOST_TEST_EQ(*it, "ab");
+    BOOST_TEST_THROWS(++it, line_length_error);
+  }
+
+  // Lines can be counted without being copied.
+  {
+    const std::string s = "a\nb\n\nc";
+    BOOST_TEST_EQ(count_tokens(s.begin(), s.end(), lines()), 4u);
+  }
+
+  // Pointers to other types than Char are read one character at a time.
+  {
+    const unsigned char bytes[] = "bytes\r\nof\n\nlines";
+    tokenizer<lines, const unsigned char*> t(bytes, bytes + sizeof(bytes) - 1,
+                                             lines());
+    std::vector<std::string> v(t.begin(), t.end());
+    BOOST_TEST(v.size() == 4u);
+    BOOST_TEST(v[0] == "bytes" && v[1] == "of" && v[2].empty() &&
+               v[3] == "lines");
+
+    const char narrow[] = "narrow\nlines";
+    tokenizer<line_separator<wchar_t>, const char*, std::wstring>
+      w(narrow, narrow + sizeof(narrow) - 1, line_separator<wchar_t>());
+    std::vector<std::wstring> wv(w.begin(), w.end());
+    BOOST_TEST(wv.size() == 2u);
+    BOOST_TEST(wv[0] == L"narrow" && wv[1] == L"lines");
+  }
+
+  {
+    std::wstring s = L"wide\r\nlines";
+    tokenizer<line_separator<wchar_t>, std::wstring::const_iterator,
+              std::wstring> t(s, line_separator<wchar_t>());
+    std::vector<std::wstring> v(t.begin(), t.end());
+    BOOST_TEST(v.size() == 2u);
+    BOOST_TEST(v[0] == L"wide");
+  }
+
+  return boost::report_errors();
+}
@@ -0,0 +1,104 @@
+// Boost tokenizer located_token tests  -------------------------------------//
+
+// Copyright 2026 Boost.Tokenizer contributors.
+
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// See http://www.boost.org for updates, documentation, and revision history.
+
+#include <boost/tokenizer/located_token.hpp>
+
+#include <cstddef>
+#include <string>
+#include <utility>
+#include <vector>
+#include <boost/tokenizer.hpp>
+#include <boost/tokenizer/lenient_escaped_list_separator.hpp>
+#include <boost/tokenizer/line_separator.hpp>
+#include <boost/core/lightweight_test.hpp>
+
+namespace {
+
+  typedef std::string::const_iterator iter;
+  typedef boost::located_token<iter> located;
+  typedef std::pair<std::size_t, std::size_t> span;
+
+  // The tokens, and the spans of input they were found in.
+  template <class TokenizerFunc>
+  std::vector<located> locate(const std::string& s, const TokenizerFunc& f)
+  {
+    boost::tokenizer<TokenizerFunc, iter, located> t(s, f);
+    return std::vector<located>(t.begin(), t.end());
+  }
+
+  // The values must be those of a tokenizer with string tokens, and each
+  // token must be found in order, at its span.
+  template <class TokenizerFunc>
+  void check_text(const std::string& s, const TokenizerFunc& f)
+  {
+    boost::tokenizer<TokenizerFunc> plain(s, f);
+    std::vector<std::string> expected(plain.begin(), plain.end());
+    std::vector<located> v = locate(s, f);
+    BOOST_TEST_EQ(v.size(), expected.size());
+    std::size_t at = 0;
+    for (std::size_t i = 0; i < v.size() && i < expected.size(); ++i) {
+      BOOST_TEST_EQ(v[i].value(), expected[i]);
+      span o = v[i].offsets(s.begin());
+      BOOST_TEST(o.first >= at && o.first <= o.second);
+      BOOST_TEST_EQ(s.substr(o.first, o.second - o.first), expected[i]);
+      at = o.second;
+    }
+  }
+
+} // namespace
+
+int main()
+{
+  using namespace boost;
+
+  const char* inputs[] = {
+    "", "a", ";", "|", ";;Hello|world||-foo--bar;yow;baz|", "|a|",
+    "x;|;x", ";|"
+  };
+  for (std::size_t i = 0; i < sizeof(inputs) / sizeof(inputs[0]); ++i) {
+    std::string s = inputs[i];
+    check_text(s, char_separator<char>("-;|"));
+    check_text(s, char_separator<char>("-;", "|", keep_empty_tokens));
+    const int offsets[] = { 2, 3 };
+    check_text(s, offset_separator(offsets, offsets + 2));
+    check_text(s, char_delimiters_separator<char>(false, "|", "-;"));
+    check_text(s, char_delimiters_separator<char>(true, "|", "-;"));
+    check_text(s, line_separator<char>());
+  }
+
+  // escaped_list_separator: the spans keep the quotes and escapes.
+  {
+    std::string s = "Field 1,\"quoted, field\",a\\nb,,";
+    std::vector<located> v = locate(s, escaped_list_separator<char>());
+    BOOST_TEST_EQ(v.size(), 5u);
+    BOOST_TEST_EQ(v[1].value(), "quoted, field");
+    BOOST_TEST(v[1].offsets(s.begin()) == span(8, 23));
+    BOOST_TEST_EQ(v[2].value(), "a\nb");
+    BOOST_TEST(v[2].offsets(s.begin()) == span(24, 28));
+    BOOST_TEST(v[3].offsets(s.begin()) == span(29, 29));
+    BOOST_TEST(v[4].offsets(s.begin()) == span(30, 30));
+
+    std::vector<located> w = locate(s,
+      lenient_escaped_list_separator<char>());
+    BOOST_TEST(w == v);
+  }
+
+  // The same with the token iterator's base(), which is past the token.
+  {
+    std::string s = "ab  cd";
+    typedef token_iterator<char_separator<char>, iter, located> located_iter;
+    located_iter it(char_separator<char>(" "), s.begin(), s.end());
+    ++it;
+    BOOST_TEST(it->source_begin() == s.begin() + 4);
+    BOOST_TEST(it->source_end() == it.base());
+  }
+
+  return boost::report_errors();
+}
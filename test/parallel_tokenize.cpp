@@ -0,0 +1,244 @@
+// Boost tokenizer parallel_tokenize tests  ---------------------------------//
+
+// Copyright 2026 Boost.Tokenizer contributors.
+
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// See http://www.boost.org for updates, documentation, and revision history.
+
+#include <boost/tokenizer/parallel_tokenize.hpp>
+
+#include <boost/core/lightweight_test.hpp>
+
+#if !defined(BOOST_NO_CXX11_HDR_THREAD) && \
+    !defined(BOOST_NO_CXX11_HDR_MUTEX) && \
+    !defined(BOOST_NO_CXX11_HDR_ATOMIC) && \
+    !defined(BOOST_NO_CXX11_HDR_CONDITION_VARIABLE) && \
+    !defined(BOOST_NO_CXX11_HDR_EXCEPTION) && \
+    !defined(BOOST_NO_CXX11_LAMBDAS)
+
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+#include <string>
+#include <vector>
+#include <boost/tokenizer.hpp>
+
+namespace {
+
+  typedef std::vector<std::string> strings;
+
+  template <class TokenizerFunc>
+  strings tokenized(const std::string& s, const TokenizerFunc& f)
+  {
+    boost::tokenizer<TokenizerFunc> t(s, f);
+    return strings(t.begin(), t.end());
+  }
+
+  strings tokens_of(const boost::document_tokens<char>& d)
+  {
+    strings v;
+    for (std::size_t i = 0; i < d.size(); ++i) {
+      BOOST_TEST_EQ(d.token(i),
+                    std::string(d.token_data(i), d.token_size(i)));
+      v.push_back(d.token(i));
+    }
+    return v;
+  }
+
+  // Documents of very different sizes, so that some workers run out of
+  // work long before others.
+  strings make_documents(std::size_t n)
+  {
+    strings docs;
+    unsigned seed = 12345;
+    for (std::size_t d = 0; d < n; ++d) {
+      seed = seed * 1103515245u + 12345u;
+      std::size_t words = (d % 97 == 0) ? 2000 : (seed >> 16) % 12;
+      std::string doc;
+      for (std::size_t w = 0; w < words; ++w) {
+        seed = seed * 1103515245u + 12345u;
+        doc += std::string(1 + (seed >> 16) % 7, char('a' + w % 26));
+        doc += (seed >> 24) % 3 == 0 ? ",," : ", ";
+      }
+      docs.push_back(doc);
+    }
+    return docs;
+  }
+
+  struct ordered_sink {
+    std::vector<strings>* out;
+    std::size_t* next;
+
+    void operator()(const boost::document_tokens<char>& d) const {
+      BOOST_TEST_EQ(d.document(), *next);
+      ++*next;
+      out->push_back(tokens_of(d));
+    }
+  };
+
+  struct unordered_sink {
+    std::vector<strings>* out;
+    std::vector<int>* seen;
+    std::mutex* lock;
+
+    void operator()(const boost::document_tokens<char>& d) const {
+      strings toks = tokens_of(d);
+      std::lock_guard<std::mutex> guard(*lock);
+      (*out)[d.document()] = toks;
+      ++(*seen)[d.document()];
+    }
+  };
+
+  struct throwing_separator {
+    boost::char_separator<char> sep;
+
+    throwing_separator() : sep(" ") { }
+
+    void reset() { sep.reset(); }
+
+    template <class Iterator, class Token>
+    bool operator()(Iterator& next, Iterator end, Token& tok) {
+      Iterator start = next;
+      bool found = sep(next, end, tok);
+      if (std::string(start, next).find("bad") != std::string::npos)
+        throw boost::escaped_list_error("bad token");
+      return found;
+    }
+  };
+
+  // Counts the documents the workers have started on.
+  struct counting_separator {
+    boost::char_separator<char> sep;
+    std::atomic<std::size_t>* started;
+
+    void reset() { sep.reset(); ++*started; }
+
+    template <class Iterator, class Token>
+    bool operator()(Iterator& next, Iterator end, Token& tok) {
+      return sep(next, end, tok);
+    }
+  };
+
+  struct window_sink {
+    const std::atomic<std::size_t>* started;
+    std::size_t window;
+    std::size_t* next;
+
+    void operator()(const boost::document_tokens<char>& d) const {
+      BOOST_TEST_EQ(d.document(), *next);
+      BOOST_TEST(*started <= d.document() + 1 + window);
+      ++*next;
+    }
+  };
+
+  void ignore(const boost::document_tokens<char>&) { }
+
+  void throw_on_100(const boost::document_tokens<char>& d) {
+    if (d.document() == 100)
+      throw boost::escaped_list_error("sink");
+  }
+
+} // namespace
+
+int main()
+{
+  using namespace boost;
+
+  const strings docs = make_documents(1000);
+  const char_separator<char> sep(" ", ",", keep_empty_tokens);
+  std::vector<strings> expected;
+  for (std::size_t d = 0; d < docs.size(); ++d)
+    expected.push_back(tokenized(docs[d], sep));
+
+  const std::size_t threads[] = { 0, 1, 2, 3, 8 };
+  for (std::size_t t = 0; t < sizeof(threads) / sizeof(threads[0]); ++t) {
+    // Ordered: every document once, in order, on this thread.
+    {
+      std::vector<strings> out;
+      std::size_t next = 0;
+      ordered_sink sink = { &out, &next };
+      parallel_tokenize(docs, sep, sink, ordered_output, threads[t]);
+      BOOST_TEST(out == expected);
+    }
+
+    // Unordered: every document once.
+    {
+      std::vector<strings> out(docs.size());
+      std::vector<int> seen(docs.size());
+      std::mutex lock;
+      unordered_sink sink = { &out, &seen, &lock };
+      parallel_tokenize(docs, sep, sink, unordered_output, threads[t]);
+      BOOST_TEST(out == expected);
+      BOOST_TEST(seen == std::vector<int>(docs.size(), 1));
+    }
+  }
+
+  // Other separators, and fewer documents than threads.
+  {
+    strings lines;
+    lines.push_back("Field 1,\"putting quotes around fields, allows commas\"");
+    lines.push_back("");
+    lines.push_back("a,b,\"c\"");
+    std::vector<strings> out;
+    std::size_t next = 0;
+    ordered_sink sink = { &out, &next };
+    parallel_tokenize(lines, escaped_list_separator<char>(), sink,
+                      ordered_output, 8);
+    BOOST_TEST_EQ(out.size(), 3u);
+    BOOST_TEST_EQ(out[0][1], "putting quotes around fields, allows commas");
+    BOOST_TEST(out[1].empty());
+    BOOST_TEST_EQ(out[2][2], "c");
+  }
+
+  // Ordered output does not let the workers get far ahead of the sink.
+  {
+    std::atomic<std::size_t> started(0);
+    counting_separator counting = { char_separator<char>(" "), &started };
+    std::size_t next = 0;
+    window_sink sink = { &started, 4 * 3, &next };
+    parallel_tokenize(docs, counting, sink, ordered_output, 3);
+    BOOST_TEST_EQ(next, docs.size());
+    BOOST_TEST_EQ(started, docs.size());
+  }
+
+  // No documents.
+  {
+    std::vector<strings> out;
+    std::size_t next = 0;
+    ordered_sink sink = { &out, &next };
+    parallel_tokenize(strings(), sep, sink, ordered_output);
+    BOOST_TEST(out.empty());
+  }
+
+  // An exception in one worker stops them all and reaches the caller.
+  {
+    strings bad = make_documents(200);
+    bad[150] += " bad ";
+    BOOST_TEST_THROWS(parallel_tokenize(bad, throwing_separator(), ignore,
+                                        unordered_output, 4),
+                      escaped_list_error);
+    BOOST_TEST_THROWS(parallel_tokenize(bad, throwing_separator(), ignore,
+                                        ordered_output, 4),
+                      escaped_list_error);
+    BOOST_TEST_THROWS(parallel_tokenize(docs, sep, throw_on_100,
+                                        ordered_output, 4),
+                      escaped_list_error);
+    BOOST_TEST_THROWS(parallel_tokenize(docs, sep, throw_on_100,
+                                        unordered_output, 4),
+                      escaped_list_error);
+  }
+
+  return boost::report_errors();
+}
+
+#else
+
+int main()
+{
+  return boost::report_errors();
+}
+
+#endif
@@ -0,0 +1,238 @@
+// Boost tokenizer push_tokenizer tests  ------------------------------------//
+
+// Copyright 2026 Boost.Tokenizer contributors.
+
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// See http://www.boost.org for updates, documentation, and revision history.
+
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <boost/tokenizer.hpp>
+#include <boost/tokenizer/ascii_word_separator.hpp>
+#include <boost/tokenizer/push_tokenizer.hpp>
+#include <boost/tokenizer/unicode_separator.hpp>
+#include <boost/tokenizer/word_tokenizer.hpp>
+#include <boost/array.hpp>
+
+#include <boost/core/lightweight_test.hpp>
+
+namespace {
+
+  template <class TokenizerFunc>
+  std::vector<std::string> tokenized(const std::string& s,
+                                     const TokenizerFunc& f)
+  {
+    boost::tokenizer<TokenizerFunc> t(s, f);
+    return std::vector<std::string>(t.begin(), t.end());
+  }
+
+  // Pushes s in buffers that end at the given positions, the last one
+  // taking the rest. Each buffer is a copy that is gone after the push.
+  template <class TokenizerFunc>
+  std::vector<std::string> pushed(const std::string& s,
+                                  const TokenizerFunc& f,
+                                  const std::vector<std::size_t>& cuts)
+  {
+    boost::push_tokenizer<TokenizerFunc> t(f);
+    std::vector<std::string> out;
+    std::string tok;
+    std::size_t pos = 0;
+    for (std::size_t i = 0; i <= cuts.size(); ++i) {
+      std::size_t cut = i < cuts.size() ? cuts[i] : s.size();
+      std::vector<char> buffer(s.begin() + pos, s.begin() + cut);
+      std::vector<char>::const_iterator next = buffer.begin();
+      std::vector<char>::const_iterator end = buffer.end();
+      while (t.push(next, end, tok))
+        out.push_back(tok);
+      BOOST_TEST(next == end);
+      pos = cut;
+    }
+    while (t.finish(tok))
+      out.push_back(tok);
+    return out;
+  }
+
+  // Compares against the tokenizer for every split of s into one, two and
+  // three buffers, and for one buffer per character.
+  template <class TokenizerFunc>
+  void check_pushed(const std::string& s, const TokenizerFunc& f)
+  {
+    std::vector<std::string> expected = tokenized(s, f);
+    std::vector<std::size_t> cuts;
+    BOOST_TEST(pushed(s, f, cuts) == expected);
+    for (std::size_t i = 0; i <= s.size(); ++i) {
+      for (std::size_t j = i; j <= s.size(); ++j) {
+        cuts.clear();
+        cuts.push_back(i);
+        cuts.push_back(j);
+        BOOST_TEST(pushed(s, f, cuts) == expected);
+      }
+    }
+    cuts.clear();
+    for (std::size_t i = 1; i < s.size(); ++i)
+      cuts.push_back(i);
+    BOOST_TEST(pushed(s, f, cuts) == expected);
+  }
+
+  // A TokenizerFunction without a push member that fails at the end of
+  // its input.
+  struct throwing_separator {
+    void reset() { }
+    template <class Iterator, class Token>
+    bool operator()(Iterator& next, Iterator end, Token&) {
+      next = end;
+      throw std::runtime_error("end of input");
+    }
+  };
+
+} // namespace
+
+int main()
+{
+  using namespace boost;
+
+  const char* inputs[] = {
+    "", "a", ";", "|", ";;Hello|world||-foo--bar;yow;baz|", "|a|",
+    "This,,is, a.test..", "  leading and trailing  ", "x;|;x", ";|"
+  };
+  const std::size_t n_inputs = sizeof(inputs) / sizeof(inputs[0]);
+
+  for (std::size_t i = 0; i < n_inputs; ++i) {
+    check_pushed(inputs[i], char_separator<char>("-;|"));
+    check_pushed(inputs[i], char_separator<char>("-;", "|"));
+    check_pushed(inputs[i],
+      char_separator<char>("-;", "|", boost::keep_empty_tokens));
+    check_pushed(inputs[i],
+      char_separator<char>("-;|", "|", boost::keep_empty_tokens));
+    check_pushed(inputs[i], char_separator<char>());
+    check_pushed(inputs[i], char_delimiters_separator<char>());
+    check_pushed(inputs[i], char_delimiters_separator<char>(true));
+    check_pushed(inputs[i], char_delimiters_separator<char>(false, ",;"));
+    check_pushed(inputs[i], word_separator<char>());
+    check_pushed(inputs[i], utf8_separator("-;", "|", keep_empty_tokens));
+  }
+
+  // A multi-byte delimiter may be cut by the end of a buffer, and so may a
+  // multi-byte character of a token.
+  check_pushed("a\xE3\x80\x81\xE3\x80\x81" "b|c\xE3\x80\x81",
+    utf8_separator("\xE3\x80\x81", "|", keep_empty_tokens));
+  check_pushed("\xC3\xA9t\xC3\xA9 \xF0\x9F\x98\x80|\xE3\x80\x81x\xE3",
+    utf8_separator("\xE3\x80\x81 ", "|"));
+  check_pushed("\xC3\xA9t\xC3\xA9 \xF0\x9F\x98\x80|\xE3\x80\x81x\xE3",
+    utf8_separator("\xE3\x80\x81 ", "|", keep_empty_tokens));
+
+  // A function without a push member is scanned again with each buffer.
+  check_pushed(";;Hello|world||-foo--bar;yow;baz|", ascii_word_separator());
+
+  const char* csv_inputs[] = {
+    "", ",", "a,b", "Field 1,\"embedded,comma\",quote \\\", escape \\\\",
+    "\"a,b\",\"c\"", "a,\"b,c", "a\\,b,"
+  };
+  const std::size_t n_csv = sizeof(csv_inputs) / sizeof(csv_inputs[0]);
+
+  for (std::size_t i = 0; i < n_csv; ++i)
+    check_pushed(csv_inputs[i], escaped_list_separator<char>());
+
+  check_pushed(",1,;2\\\";3\\;,4,5^\\,\'6,7\';",
+    escaped_list_separator<char>("\\^", ",;", "\"\'"));
+
+  {
+    boost::array<int,3> offsets = {{2,2,4}};
+    const char* offset_inputs[] = { "", "1", "12252001", "1225200101012002",
+                                    "122520010101200", "12252001010120" };
+    for (std::size_t i = 0; i < 6; ++i) {
+      check_pushed(offset_inputs[i],
+        offset_separator(offsets.begin(), offsets.end()));
+      check_pushed(offset_inputs[i],
+        offset_separator(offsets.begin(), offsets.end(), false));
+      check_pushed(offset_inputs[i],
+        offset_separator(offsets.begin(), offsets.end(), true, false));
+    }
+  }
+
+  // An escape at the end of a buffer is only an error at the end of the
+  // input.
+  {
+    typedef escaped_list_separator<char> Sep;
+    push_tokenizer<Sep> t;
+    std::string tok;
+    const std::string first = "a\\", second = "n,b\\";
+    std::string::const_iterator next = first.begin();
+    BOOST_TEST(!t.push(next, first.end(), tok));
+    BOOST_TEST(t.state().pending == "a");
+    BOOST_TEST(t.state().resume.escape);
+    next = second.begin();
+    BOOST_TEST(t.push(next, second.end(), tok));
+    BOOST_TEST(tok == "a\n");
+    BOOST_TEST(!t.push(next, second.end(), tok));
+    BOOST_TEST_THROWS(t.finish(tok), escaped_list_error);
+  }
+
+  // The state can be copied to go back to an earlier point of the parse,
+  // and one separator can be shared by several states.
+  {
+    typedef escaped_list_separator<char> Sep;
+    Sep sep;
+    push_state<Sep> state(sep);
+    std::string tok;
+    const std::string first = "x,\"a,";
+    std::string::const_iterator next = first.begin();
+    BOOST_TEST(push_token(sep, state, next, first.end(), tok));
+    BOOST_TEST(tok == "x");
+    BOOST_TEST(!push_token(sep, state, next, first.end(), tok));
+    BOOST_TEST(state.pending == "a,");
+    BOOST_TEST(state.resume.in_quote);
+
+    push_state<Sep> saved = state;
+    const std::string second = "b\",c";
+    next = second.begin();
+    BOOST_TEST(push_token(sep, state, next, second.end(), tok));
+    BOOST_TEST(tok == "a,b");
+
+    state = saved;
+    const std::string other = "z\"";
+    next = other.begin();
+    BOOST_TEST(!push_token(sep, state, next, other.end(), tok));
+    BOOST_TEST(finish_tokens(sep, state, tok));
+    BOOST_TEST(tok == "a,z");
+    BOOST_TEST(!finish_tokens(sep, state, tok));
+  }
+
+  // A token is read once, however many buffers it spans, and its
+  // characters are kept in the state as they come.
+  {
+    push_tokenizer<char_separator<char> > t(char_separator<char>(" "));
+    std::string tok;
+    const std::string piece = "abcd";
+    for (int i = 0; i < 1000; ++i) {
+      std::string::const_iterator next = piece.begin();
+      BOOST_TEST(!t.push(next, piece.end(), tok));
+    }
+    BOOST_TEST_EQ(t.state().pending.size(), 4000u);
+    BOOST_TEST(t.state().resume.in_token);
+    const std::string last = "e f";
+    std::string::const_iterator next = last.begin();
+    BOOST_TEST(t.push(next, last.end(), tok));
+    BOOST_TEST_EQ(tok.size(), 4001u);
+    BOOST_TEST(!t.push(next, last.end(), tok));
+    BOOST_TEST(t.finish(tok));
+    BOOST_TEST(tok == "f");
+  }
+
+  // Only the end of the input is an error for a cut escape sequence;
+  // other exceptions are not taken for a short buffer.
+  {
+    push_tokenizer<throwing_separator> t;
+    std::string tok;
+    const std::string buffer = "ab";
+    std::string::const_iterator next = buffer.begin();
+    BOOST_TEST_THROWS(t.push(next, buffer.end(), tok), std::runtime_error);
+  }
+
+  return boost::report_errors();
+}
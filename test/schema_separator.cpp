@@ -0,0 +1,163 @@
+// Boost tokenizer schema_separator tests  ----------------------------------//
+
+// Copyright 2026 Boost.Tokenizer contributors.
+
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// See http://www.boost.org for updates, documentation, and revision history.
+
+#include <boost/tokenizer/schema_separator.hpp>
+
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <list>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <boost/tokenizer.hpp>
+#include <boost/tokenizer/token_view.hpp>
+#include <boost/core/lightweight_test.hpp>
+
+namespace {
+
+  typedef std::vector<std::string> strings;
+
+  strings tokenized(const std::string& s, const boost::schema_separator& f)
+  {
+    boost::tokenizer<boost::schema_separator> t(s, f);
+    return strings(t.begin(), t.end());
+  }
+
+  // The same tokens from a list and from an input stream.
+  strings other_iterators(const std::string& s,
+                          const boost::schema_separator& f)
+  {
+    std::list<char> l(s.begin(), s.end());
+    boost::tokenizer<boost::schema_separator, std::list<char>::const_iterator>
+      t(l, f);
+    strings from_list(t.begin(), t.end());
+
+    std::istringstream in(s);
+    typedef std::istreambuf_iterator<char> input;
+    boost::tokenizer<boost::schema_separator, input> u(input(in), input(), f);
+    BOOST_TEST(strings(u.begin(), u.end()) == from_list);
+    return from_list;
+  }
+
+  strings make(const char* a, const char* b = 0, const char* c = 0,
+               const char* d = 0)
+  {
+    strings v;
+    const char* all[] = { a, b, c, d };
+    for (std::size_t i = 0; i < 4 && all[i]; ++i)
+      v.push_back(all[i]);
+    return v;
+  }
+
+} // namespace
+
+int main()
+{
+  using namespace boost;
+
+  // Length prefixed records.
+  {
+    schema_separator sep(record_schema().length(4).counted_field());
+    std::string s = "0005hello0000" "0003abc";
+    strings expected = make("hello", "", "abc");
+    BOOST_TEST(tokenized(s, sep) == expected);
+    BOOST_TEST(other_iterators(s, sep) == expected);
+    BOOST_TEST(tokenized("", sep).empty());
+  }
+
+  // TLV: a fixed tag, a one byte binary length and the value.
+  {
+    schema_separator sep(record_schema().field(2)
+                         .length(1, binary_length).counted_field());
+    std::string s = "id";
+    s += char(3);
+    s += "abcnm";
+    s += char(0);
+    strings expected = make("id", "abc", "nm", "");
+    BOOST_TEST(tokenized(s, sep) == expected);
+    BOOST_TEST(other_iterators(s, sep) == expected);
+  }
+
+  // Fixed widths, skipped parts, and a single record.
+  {
+    record_schema date;
+    date.field(4).skip(1).field(2).skip(1).field(2);
+    BOOST_TEST_EQ(date.size(), 5u);
+    std::string s = "2026-10-18" "2027-01-02";
+    strings both = tokenized(s, schema_separator(date));
+    BOOST_TEST_EQ(both.size(), 6u);
+    BOOST_TEST_EQ(both[3], "2027");
+    BOOST_TEST_EQ(both[5], "02");
+    BOOST_TEST(tokenized(s, schema_separator(date, false)) ==
+               make("2026", "10", "18"));
+
+    schema_separator header(record_schema().length(2).skip_counted()
+                            .field(3));
+    BOOST_TEST(tokenized("03xyzabc" "00def", header) == make("abc", "def"));
+    BOOST_TEST(other_iterators("03xyzabc" "00def", header) ==
+               make("abc", "def"));
+  }
+
+  // Errors.
+  {
+    schema_separator sep(record_schema().length(2).counted_field());
+    BOOST_TEST_THROWS(tokenized("05abc", sep), record_schema_error);
+    BOOST_TEST_THROWS(tokenized("0", sep), record_schema_error);
+    BOOST_TEST_THROWS(tokenized("x1a", sep), record_schema_error);
+    BOOST_TEST_THROWS(other_iterators("05abc", sep), record_schema_error);
+    BOOST_TEST_THROWS(tokenized("01a0", sep), record_schema_error);
+    schema_separator huge(record_schema().length(30).counted_field());
+    BOOST_TEST_THROWS(tokenized(std::string(30, '9'), huge),
+                      record_schema_error);
+  }
+
+  // The largest length that fits a std::size_t is read, and one more is
+  // not.
+  {
+    std::ostringstream out;
+    out << (std::numeric_limits<std::size_t>::max)();
+    std::string max = out.str();
+    schema_separator sep(record_schema().length(max.size()));
+    BOOST_TEST(tokenized(max, sep).empty());
+    std::string over = max;
+    ++over[over.size() - 1];
+    BOOST_TEST_THROWS(tokenized(over, sep), record_schema_error);
+  }
+
+  // A repeated schema that reads nothing is rejected; a single record of
+  // empty fields, or no record at all, is not.
+  {
+    BOOST_TEST_THROWS(schema_separator(record_schema().field(0)),
+                      record_schema_error);
+    BOOST_TEST_THROWS(schema_separator(record_schema().length(0)
+                                       .counted_field().skip(0)),
+                      record_schema_error);
+    BOOST_TEST(tokenized("abc", schema_separator(record_schema().field(0),
+                                                 false)) == make(""));
+    BOOST_TEST(tokenized("abc", schema_separator()).empty());
+  }
+
+  // Token views of the input, and skipping whole fields.
+  {
+    std::string s = "0005hello0003abc";
+    typedef std::string::const_iterator iter;
+    tokenizer<schema_separator, iter, token_view<iter> > t(s,
+      schema_separator(record_schema().length(4).counted_field()));
+    tokenizer<schema_separator, iter, token_view<iter> >::iterator it =
+      t.begin();
+    BOOST_TEST(it->begin() == s.begin() + 4);
+    it.skip(1);
+    BOOST_TEST_EQ(it->str(), "abc");
+    BOOST_TEST(has_token_skip<schema_separator>::value);
+  }
+
+  return boost::report_errors();
+}
@@ -0,0 +1,163 @@
+// Boost tokenizer separator_spec tests  ------------------------------------//
+
+// Copyright 2026 Boost.Tokenizer contributors.
+
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// See http://www.boost.org for updates, documentation, and revision history.
+
+#include <cstddef>
+#include <string>
+#include <vector>
+#include <boost/config.hpp>
+#include <boost/tokenizer.hpp>
+#include <boost/tokenizer/separator_spec.hpp>
+
+#if !defined(BOOST_NO_CXX11_HDR_THREAD)
+#include <thread>
+#endif
+
+#include <boost/core/lightweight_test.hpp>
+
+namespace {
+
+  template <class TokenizerFunc, class String>
+  std::vector<String> tokenized(const String& s, const TokenizerFunc& f)
+  {
+    boost::tokenizer<TokenizerFunc, typename String::const_iterator, String>
+      t(s, f);
+    return std::vector<String>(t.begin(), t.end());
+  }
+
+  // A spec must give the same tokens as the separator it was built from.
+  template <class Separator, class Spec, class String>
+  void check_spec(const String& s, const Separator& sep, const Spec& spec)
+  {
+    typedef boost::shared_separator<Spec> Shared;
+    BOOST_TEST(tokenized(s, Shared(spec)) == tokenized(s, sep));
+    BOOST_TEST(tokenized(s, Shared(Spec(sep))) == tokenized(s, sep));
+  }
+
+  typedef boost::escaped_list_spec<char> csv_spec;
+
+  std::vector<std::string> csv_fields(const csv_spec& spec,
+                                      const std::string& line)
+  {
+    return tokenized(line, boost::shared_separator<csv_spec>(spec));
+  }
+
+} // namespace
+
+int main()
+{
+  using namespace boost;
+
+  const char* inputs[] = {
+    "", "a", ";", "|", ";;Hello|world||-foo--bar;yow;baz|", "|a|",
+    "This,,is, a.test..", "  leading and trailing  ", "x;|;x", ";|"
+  };
+  const std::size_t n_inputs = sizeof(inputs) / sizeof(inputs[0]);
+
+  typedef char_separator<char> Sep;
+  typedef char_separator_spec<char> Spec;
+  for (std::size_t i = 0; i < n_inputs; ++i) {
+    std::string s = inputs[i];
+    check_spec(s, Sep("-;|"), Spec("-;|"));
+    check_spec(s, Sep("-;", "|"), Spec("-;", "|"));
+    check_spec(s, Sep("-;", "|", keep_empty_tokens),
+               Spec("-;", "|", keep_empty_tokens));
+    check_spec(s, Sep("-;|", "|", keep_empty_tokens),
+               Spec("-;|", "|", keep_empty_tokens));
+    check_spec(s, Sep(), Spec());
+  }
+
+  const char* csv_inputs[] = {
+    "", ",", "a,b", "Field 1,\"embedded,comma\",quote \\\", escape \\\\",
+    "\"a,b\",\"c\"", "a,\"b,c", "a\\,b,", "a\\nb"
+  };
+  const std::size_t n_csv = sizeof(csv_inputs) / sizeof(csv_inputs[0]);
+
+  for (std::size_t i = 0; i < n_csv; ++i)
+    check_spec(std::string(csv_inputs[i]), escaped_list_separator<char>(),
+               csv_spec());
+
+  check_spec(std::string(",1,;2\\\";3\\;,4,5^\\,\'6,7\';"),
+    escaped_list_separator<char>("\\^", ",;", "\"\'"),
+    csv_spec("\\^", ",;", "\"\'"));
+
+  {
+    csv_spec spec;
+    BOOST_TEST_THROWS(csv_fields(spec, "a\\"), escaped_list_error);
+    BOOST_TEST_THROWS(csv_fields(spec, "a\\x"), escaped_list_error);
+  }
+
+  // Bytes above 127, negative where char is signed, in the default
+  // classes and as delimiters.
+  {
+    std::string s;
+    for (int c = 1; c < 256; ++c) {
+      s += static_cast<char>(c);
+      s += "ab";
+    }
+    check_spec(s, Sep(), Spec());
+    check_spec(s, Sep("\xa0\xff", "\x80;"), Spec("\xa0\xff", "\x80;"));
+    check_spec(s, Sep("\xa0", "\xff", keep_empty_tokens),
+               Spec("\xa0", "\xff", keep_empty_tokens));
+    check_spec(std::string("a\xff\x80 b\xff c\x80\xff\xe9\xff\xe9\xe9"),
+               escaped_list_separator<char>('\xe9', '\xff', '\x80'),
+               csv_spec('\xe9', '\xff', '\x80'));
+  }
+
+  // Wide characters above the table are classified by the separator.
+  {
+    typedef char_separator<wchar_t> WSep;
+    typedef char_separator_spec<wchar_t> WSpec;
+    std::wstring s = L"a\x3000" L"b|c\x2014";
+    const wchar_t dropped[] = { 0x3000, L';', 0 };
+    const wchar_t kept[] = { 0x2014, L'|', 0 };
+    check_spec(s, WSep(dropped, kept), WSpec(dropped, kept));
+    check_spec(s, WSep(dropped, kept, keep_empty_tokens),
+               WSpec(dropped, kept, keep_empty_tokens));
+  }
+
+  // Iterators copy only a pointer to the spec and the state.
+  {
+    Spec spec(" ", "|", keep_empty_tokens);
+    std::string s = "a||b ";
+    typedef tokenizer<shared_separator<Spec> > Tok;
+    Tok t(s, shared_separator<Spec>(spec));
+    Tok::iterator it = t.begin();
+    Tok::iterator copy = it;
+    ++it;
+    BOOST_TEST(*copy == "a");
+    BOOST_TEST(*it == "|");
+    ++copy;
+    BOOST_TEST(copy == it);
+  }
+
+#if !defined(BOOST_NO_CXX11_HDR_THREAD)
+  // One spec, shared by const reference between threads.
+  {
+    const csv_spec spec;
+    const std::string line = "1,\"two, three\",4\\n";
+    const std::vector<std::string> expected = csv_fields(spec, line);
+    std::vector<int> ok(4, 0);
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 4; ++i)
+      threads.push_back(std::thread([&spec, &line, &expected, &ok, i] {
+        bool same = true;
+        for (int n = 0; n < 1000; ++n)
+          same = same && csv_fields(spec, line) == expected;
+        ok[i] = same;
+      }));
+    for (std::size_t i = 0; i < threads.size(); ++i)
+      threads[i].join();
+    for (int i = 0; i < 4; ++i)
+      BOOST_TEST(ok[i]);
+  }
+#endif
+
+  return boost::report_errors();
+}
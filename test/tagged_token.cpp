@@ -0,0 +1,111 @@
+// Boost tokenizer tagged_token tests  --------------------------------------//
+
+// Copyright 2026 Boost.Tokenizer contributors.
+
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// See http://www.boost.org for updates, documentation, and revision history.
+
+#include <boost/tokenizer/tagged_token.hpp>
+
+#include <cstddef>
+#include <string>
+#include <vector>
+#include <boost/tokenizer.hpp>
+#include <boost/tokenizer/ascii_word_separator.hpp>
+#include <boost/tokenizer/separator_spec.hpp>
+#include <boost/core/lightweight_test.hpp>
+
+namespace {
+
+  typedef std::string::const_iterator iter;
+  typedef boost::tagged_token<iter> tagged;
+
+  // The tokens as strings, with each kept delimiter in brackets.
+  template <class TokenizerFunc>
+  std::vector<std::string> tags(const std::string& s, const TokenizerFunc& f)
+  {
+    typedef boost::tokenizer<TokenizerFunc, iter, tagged> tok_type;
+    tok_type t(s, f);
+    std::vector<std::string> v;
+    for (typename tok_type::iterator it = t.begin(); it != t.end(); ++it) {
+      if (it->is_delimiter()) {
+        BOOST_TEST_EQ(it->size(), 1u);
+        v.push_back("[" + std::string(1, it->delimiter()) + "]");
+      }
+      else
+        v.push_back(it->str());
+    }
+    return v;
+  }
+
+  // The same, from string tokens and the list of kept delimiters. A one
+  // char token that is a kept delimiter can only be one.
+  template <class TokenizerFunc>
+  std::vector<std::string> expected(const std::string& s,
+                                    const TokenizerFunc& f,
+                                    const std::string& kept)
+  {
+    boost::tokenizer<TokenizerFunc> t(s, f);
+    std::vector<std::string> v;
+    for (typename boost::tokenizer<TokenizerFunc>::iterator it = t.begin();
+         it != t.end(); ++it) {
+      if (it->size() == 1 && kept.find((*it)[0]) != std::string::npos)
+        v.push_back("[" + *it + "]");
+      else
+        v.push_back(*it);
+    }
+    return v;
+  }
+
+} // namespace
+
+int main()
+{
+  using namespace boost;
+
+  const char* inputs[] = {
+    "", "a", ";", "|", ";;Hello|world||-foo--bar;yow;baz|", "|a|",
+    "x;|;x", ";|", "a + b*(c - d)/e"
+  };
+  for (std::size_t i = 0; i < sizeof(inputs) / sizeof(inputs[0]); ++i) {
+    std::string s = inputs[i];
+    char_separator<char> drop("-; ", "|+*/()");
+    char_separator<char> keep("-;", "|", keep_empty_tokens);
+    BOOST_TEST(tags(s, drop) == expected(s, drop, "|+*/()"));
+    BOOST_TEST(tags(s, keep) == expected(s, keep, "|"));
+    char_separator_spec<char> spec(drop);
+    BOOST_TEST(tags(s, shared_separator<char_separator_spec<char> >(spec)) ==
+               expected(s, drop, "|+*/()"));
+    ascii_word_separator words(keep_punctuation);
+    BOOST_TEST(tags(s, words) == expected(s, words, "-;|+*/()"));
+  }
+
+  // Other separators leave every token as data.
+  {
+    std::string s = "ab,c";
+    tokenizer<escaped_list_separator<char>, iter, std::string> t(s);
+    BOOST_TEST_EQ(std::vector<std::string>(t.begin(), t.end()).size(), 2u);
+    const int offsets[] = { 1 };
+    tokenizer<offset_separator, iter, tagged> o(s,
+      offset_separator(offsets, offsets + 1));
+    for (tokenizer<offset_separator, iter, tagged>::iterator it = o.begin();
+         it != o.end(); ++it)
+      BOOST_TEST(!it->is_delimiter());
+  }
+
+  // Comparison looks at the kind as well as the text.
+  {
+    std::string s = "||";
+    tagged a(s.begin(), s.begin() + 1, delimiter_token);
+    tagged b(s.begin() + 1, s.end(), delimiter_token);
+    tagged c(s.begin() + 1, s.end());
+    BOOST_TEST(a == b);
+    BOOST_TEST(b != c);
+    BOOST_TEST_EQ(c.kind(), data_token);
+  }
+
+  return boost::report_errors();
+}
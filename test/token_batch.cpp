@@ -0,0 +1,114 @@
+// Boost tokenizer token_batch tests  ---------------------------------------//
+
+// Copyright 2026 Boost.Tokenizer contributors.
+
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// See http://www.boost.org for updates, documentation, and revision history.
+
+#include <cstddef>
+#include <list>
+#include <string>
+#include <vector>
+#include <boost/tokenizer.hpp>
+#include <boost/tokenizer/token_batch.hpp>
+#include <boost/array.hpp>
+
+#include <boost/core/lightweight_test.hpp>
+
+namespace {
+
+  // Checks the batch against a tokenizer over each input.
+  template <class TokenizerFunc>
+  void check_batch(const std::vector<std::string>& inputs,
+                   const TokenizerFunc& f)
+  {
+    boost::token_batch<> batch;
+    boost::tokenize_batch(inputs, f, batch);
+    BOOST_TEST_EQ(batch.size(), inputs.size());
+
+    std::size_t total = 0;
+    for (std::size_t i = 0; i < inputs.size(); ++i) {
+      boost::tokenizer<TokenizerFunc> t(inputs[i], f);
+      std::vector<std::string> expected(t.begin(), t.end());
+      std::pair<std::size_t,std::size_t> r = batch.tokens_of(i);
+      BOOST_TEST_EQ(r.first, total);
+      BOOST_TEST_EQ(r.second - r.first, expected.size());
+      for (std::size_t j = 0; j < expected.size() && r.first + j < r.second;
+           ++j)
+        BOOST_TEST_EQ(batch.token(r.first + j), expected[j]);
+      total += expected.size();
+    }
+    BOOST_TEST_EQ(batch.token_count(), total);
+  }
+
+} // namespace
+
+int main()
+{
+  using namespace boost;
+
+  std::vector<std::string> inputs;
+  inputs.push_back(";;Hello|world||-foo--bar;yow;baz|");
+  inputs.push_back("");
+  inputs.push_back("|a|");
+  inputs.push_back("This,,is, a.test..");
+  inputs.push_back(";");
+  inputs.push_back("  leading and trailing  ");
+
+  check_batch(inputs, char_separator<char>("-;|"));
+  check_batch(inputs, char_separator<char>("-;", "|"));
+  check_batch(inputs,
+    char_separator<char>("-;", "|", boost::keep_empty_tokens));
+  check_batch(inputs, char_delimiters_separator<char>());
+
+  {
+    std::vector<std::string> csv;
+    csv.push_back("Field 1,\"embedded,comma\",quote \\\", escape \\\\");
+    csv.push_back("a,b,");
+    csv.push_back(",");
+    csv.push_back("");
+    check_batch(csv, escaped_list_separator<char>());
+    csv.push_back(",1,;2\\\";3\\;,4,5^\\,\'6,7\';");
+    check_batch(csv, escaped_list_separator<char>("\\^", ",;", "\"\'"));
+  }
+
+  // A short last field that is not returned leaves nothing behind.
+  {
+    boost::array<int,3> offsets = {{2,2,4}};
+    std::vector<std::string> dates;
+    dates.push_back("1225200101012002");
+    dates.push_back("12252");
+    dates.push_back("122520010");
+    check_batch(dates, offset_separator(offsets.begin(), offsets.end()));
+    check_batch(dates,
+      offset_separator(offsets.begin(), offsets.end(), true, false));
+  }
+
+  // Batches accumulate, and the flat arrays describe all tokens.
+  {
+    std::list<std::string> lines;
+    lines.push_back("a b");
+    lines.push_back("cd");
+    token_batch<> batch;
+    tokenize_batch(lines.begin(), lines.end(), char_separator<char>(" "),
+                   batch);
+    tokenize_batch(lines.begin(), lines.end(), char_separator<char>(" "),
+                   batch);
+    BOOST_TEST_EQ(batch.size(), 4u);
+    BOOST_TEST_EQ(batch.token_count(), 6u);
+    BOOST_TEST_EQ(batch.chars(), "abcdabcd");
+    BOOST_TEST_EQ(batch.token_offsets()[3], 4u);
+    BOOST_TEST_EQ(batch.input_offsets()[2], 3u);
+    BOOST_TEST_EQ(batch.token_size(2), 2u);
+    BOOST_TEST_EQ(std::string(batch.token_data(2), 2), "cd");
+
+    batch.clear();
+    BOOST_TEST(batch.empty());
+    BOOST_TEST_EQ(batch.token_count(), 0u);
+  }
+
+  return boost::report_errors();
+}
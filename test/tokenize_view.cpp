@@ -0,0 +1,161 @@
+// Boost tokenizer tokenize_view tests  -------------------------------------//
+
+// Copyright 2026 Boost.Tokenizer contributors.
+
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// See http://www.boost.org for updates, documentation, and revision history.
+
+#include <boost/tokenizer/tokenize_view.hpp>
+
+#include <boost/core/lightweight_test.hpp>
+
+#if defined(BOOST_TOKENIZER_HAS_RANGES)
+
+#include <cstddef>
+#include <list>
+#include <ranges>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <boost/tokenizer.hpp>
+#include <boost/tokenizer/token_view.hpp>
+
+namespace {
+
+  // A char_separator that counts the characters it reads.
+  struct counting_separator {
+    boost::char_separator<char> sep;
+    std::size_t* read;
+
+    counting_separator() : sep(" "), read(0) { }
+    explicit counting_separator(std::size_t* r) : sep(" "), read(r) { }
+
+    void reset() { sep.reset(); }
+
+    template <class Iterator, class Token>
+    bool operator()(Iterator& next, Iterator end, Token& tok) {
+      Iterator start = next;
+      bool found = sep(next, end, tok);
+      *read += static_cast<std::size_t>(std::distance(start, next));
+      return found;
+    }
+  };
+
+  template <class Range>
+  std::vector<std::string> collected(Range&& r)
+  {
+    std::vector<std::string> v;
+    for (auto&& tok : r)
+      v.push_back(std::string(tok.begin(), tok.end()));
+    return v;
+  }
+
+  template <class TokenizerFunc>
+  std::vector<std::string> tokenized(const std::string& s,
+                                     const TokenizerFunc& f)
+  {
+    boost::tokenizer<TokenizerFunc> t(s, f);
+    return std::vector<std::string>(t.begin(), t.end());
+  }
+
+  static_assert(std::ranges::forward_range<
+    boost::tokenize_view<std::string_view, boost::char_separator<char> > >);
+  static_assert(std::ranges::view<
+    boost::tokenize_view<std::string_view, boost::char_separator<char> > >);
+
+} // namespace
+
+int main()
+{
+  using namespace boost;
+
+  // The tokens are those of a tokenizer.
+  const char* inputs[] = {
+    "", "a", ";", "|", ";;Hello|world||-foo--bar;yow;baz|", "|a|",
+    "x;|;x", ";|"
+  };
+  for (std::size_t i = 0; i < sizeof(inputs) / sizeof(inputs[0]); ++i) {
+    const std::string s = inputs[i];
+    char_separator<char> drop("-;|");
+    char_separator<char> keep("-;", "|", keep_empty_tokens);
+    BOOST_TEST(collected(s | views::tokenize(drop)) == tokenized(s, drop));
+    BOOST_TEST(collected(views::tokenize(s, keep)) == tokenized(s, keep));
+    BOOST_TEST(collected(s | views::tokenize(escaped_list_separator<char>()))
+               == tokenized(s, escaped_list_separator<char>()));
+  }
+
+  // take(3) reads no further than the end of the third token.
+  {
+    const std::string line = "one two three four five six";
+    std::size_t read = 0;
+    std::vector<std::string> v = collected(line |
+      views::tokenize(counting_separator(&read)) | std::views::take(3));
+    BOOST_TEST_EQ(v.size(), 3u);
+    BOOST_TEST_EQ(v[2], "three");
+    BOOST_TEST_EQ(read, std::string("one two three").size());
+  }
+
+  // Composes with the standard adaptors, lazily.
+  {
+    const std::string line = "a bb ccc dd e";
+    auto long_sizes = line | views::tokenize(char_separator<char>(" "))
+      | std::views::filter([](const std::string& t) { return t.size() > 1; })
+      | std::views::transform([](const std::string& t) { return t.size(); });
+    std::vector<std::size_t> sizes;
+    for (std::size_t n : long_sizes)
+      sizes.push_back(n);
+    BOOST_TEST_EQ(sizes.size(), 3u);
+    BOOST_TEST_EQ(sizes[1], 3u);
+
+    auto rest = line | views::tokenize(char_separator<char>(" "))
+      | std::views::drop(3);
+    BOOST_TEST(collected(rest) == std::vector<std::string>({"dd", "e"}));
+  }
+
+  // Iterators compare equal at the same token, found or not.
+  {
+    const std::string line = "x y z";
+    auto toks = views::tokenize(line, char_separator<char>(" "));
+    auto a = toks.begin();
+    auto b = toks.begin();
+    ++a;
+    BOOST_TEST_EQ(*b, "x");
+    ++b;
+    BOOST_TEST(a == b);
+    BOOST_TEST_EQ(*a, "y");
+    BOOST_TEST_EQ(std::ranges::distance(toks), 3);
+  }
+
+  // Any forward range, and any token type.
+  {
+    const std::string text = "list of chars";
+    std::list<char> l(text.begin(), text.end());
+    std::vector<std::string> v = collected(
+      l | views::tokenize(char_separator<char>(" ")));
+    BOOST_TEST_EQ(v.size(), 3u);
+    BOOST_TEST_EQ(v[2], "chars");
+
+    std::string_view sv = text;
+    typedef token_view<std::string_view::const_iterator> view_token;
+    tokenize_view<std::string_view, char_separator<char>, view_token>
+      views_of(sv, char_separator<char>(" "));
+    auto it = views_of.begin();
+    ++it;
+    BOOST_TEST(it->begin() == sv.begin() + 5);
+    BOOST_TEST_EQ(it->size(), 2u);
+  }
+
+  return boost::report_errors();
+}
+
+#else
+
+int main()
+{
+  return boost::report_errors();
+}
+
+#endif
@@ -0,0 +1,115 @@
+// Boost tokenizer typed_tokenizer tests  -----------------------------------//
+
+// Copyright 2026 Boost.Tokenizer contributors.
+
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// See http://www.boost.org for updates, documentation, and revision history.
+
+#include <boost/tokenizer/typed_tokenizer.hpp>
+
+#include <boost/core/lightweight_test.hpp>
+
+#if defined(BOOST_TOKENIZER_HAS_FROM_CHARS)
+
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <boost/array.hpp>
+#include <boost/tokenizer.hpp>
+
+int main()
+{
+  using namespace boost;
+
+  {
+    typedef std::tuple<int, double, std::string_view, std::string> Schema;
+    typed_tokenizer<escaped_list_separator<char>, Schema> t;
+
+    const std::string record = "42,9.5,widget,\"blue, large\"";
+    Schema fields = t.parse(record);
+    BOOST_TEST_EQ(std::get<0>(fields), 42);
+    BOOST_TEST_EQ(std::get<1>(fields), 9.5);
+    BOOST_TEST(std::get<2>(fields) == "widget");
+    BOOST_TEST_EQ(std::get<3>(fields), "blue, large");
+
+    // Quoted fields are converted after the quotes are removed.
+    t.parse("-7,1e3,\"a,b\",x", fields);
+    BOOST_TEST_EQ(std::get<0>(fields), -7);
+    BOOST_TEST_EQ(std::get<1>(fields), 1000.0);
+    BOOST_TEST(std::get<2>(fields) == "a,b");
+    BOOST_TEST_EQ(std::get<3>(fields), "x");
+
+    BOOST_TEST_THROWS(t.parse("1,2,3"), typed_field_error);
+    BOOST_TEST_THROWS(t.parse("1,2,3,4,5"), typed_field_error);
+    BOOST_TEST_THROWS(t.parse("1x,2,3,4"), typed_field_error);
+    BOOST_TEST_THROWS(t.parse(",2,3,4"), typed_field_error);
+
+    try {
+      t.parse("1,two,3,4");
+      BOOST_ERROR("no exception");
+    }
+    catch (const typed_field_error& e) {
+      BOOST_TEST_EQ(e.field(), 1u);
+    }
+  }
+
+  // Fields that escaped_list_separator unescapes are built in one buffer,
+  // which keeps its storage from one field to the next.
+  {
+    const std::string record =
+      "\"a field too long for the small string buffer\",\"a,b\",\"\"";
+    escaped_list_separator<char> sep;
+    tokenizer_detail::field_token tok;
+    const char* next = record.data();
+    const char* end = next + record.size();
+    BOOST_TEST(sep(next, end, tok));
+    const char* storage = tok.buffer().data();
+    BOOST_TEST(sep(next, end, tok));
+    BOOST_TEST(tok.view() == "a,b");
+    BOOST_TEST(tok.buffer().data() == storage);
+    BOOST_TEST(sep(next, end, tok));
+    BOOST_TEST(tok.view().empty());
+    BOOST_TEST(tok.buffer().data() == storage);
+  }
+
+  // Fields found by char_separator are parsed straight from the input.
+  {
+    typedef std::tuple<unsigned, long long, float, std::string_view> Schema;
+    typed_tokenizer<char_separator<char>, Schema> t(char_separator<char>(" "));
+    const std::string record = "  7 -9000000000   0.25 name";
+    Schema fields = t.parse(record);
+    BOOST_TEST_EQ(std::get<0>(fields), 7u);
+    BOOST_TEST_EQ(std::get<1>(fields), -9000000000LL);
+    BOOST_TEST_EQ(std::get<2>(fields), 0.25f);
+    BOOST_TEST(std::get<3>(fields) == "name");
+    BOOST_TEST(std::get<3>(fields).data() == record.data() + 23);
+
+    BOOST_TEST_THROWS(t.parse("-1 0 0 x"), typed_field_error);
+    BOOST_TEST_THROWS(t.parse("99999999999 0 0 x"), typed_field_error);
+  }
+
+  {
+    boost::array<int,3> offsets = {{4,2,2}};
+    typedef std::tuple<int, int, int> Schema;
+    typed_tokenizer<offset_separator, Schema>
+      t(offset_separator(offsets.begin(), offsets.end(), false));
+    Schema fields = t.parse("20261018");
+    BOOST_TEST_EQ(std::get<0>(fields), 2026);
+    BOOST_TEST_EQ(std::get<1>(fields), 10);
+    BOOST_TEST_EQ(std::get<2>(fields), 18);
+  }
+
+  return boost::report_errors();
+}
+
+#else
+
+int main()
+{
+  return boost::report_errors();
+}
+
+#endif
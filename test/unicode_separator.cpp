@@ -0,0 +1,154 @@
+// Boost tokenizer unicode_separator tests  ---------------------------------//
+
+// Copyright 2026 Boost.Tokenizer contributors.
+
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// See http://www.boost.org for updates, documentation, and revision history.
+
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <boost/tokenizer.hpp>
+#include <boost/tokenizer/token_batch.hpp>
+#include <boost/tokenizer/unicode_separator.hpp>
+
+#include <boost/core/lightweight_test.hpp>
+
+int main()
+{
+  using namespace boost;
+
+  // Default: Unicode White_Space dropped, punctuation kept.
+  {
+    // "Gr\u00FC\u00DFe, Welt!" followed by an ideographic space, guillemets,
+    // two CJK characters and an ideographic full stop.
+    const std::string test_string =
+      "Gr\xC3\xBC\xC3\x9F" "e, Welt!\xE3\x80\x80\xC2\xAB" "Hallo\xC2\xBB"
+      "\xE4\xBD\xA0\xE5\xA5\xBD\xE3\x80\x82" "end";
+    std::string answer[] = { "Gr\xC3\xBC\xC3\x9F" "e", ",", "Welt", "!",
+      "\xC2\xAB", "Hallo", "\xC2\xBB", "\xE4\xBD\xA0\xE5\xA5\xBD",
+      "\xE3\x80\x82", "end" };
+    typedef tokenizer<utf8_separator> Tok;
+    Tok t(test_string);
+    BOOST_TEST(std::distance(t.begin(), t.end()) == 10);
+    BOOST_TEST(std::equal(t.begin(), t.end(), answer));
+  }
+
+  // Explicit multi-byte delimiters and empty tokens.
+  {
+    // U+3001 IDEOGRAPHIC COMMA is dropped, '|' is kept.
+    const std::string test_string = "a\xE3\x80\x81\xE3\x80\x81" "b|c";
+    std::string answer[] = { "a", "", "b", "|", "c" };
+    typedef tokenizer<utf8_separator> Tok;
+    utf8_separator sep("\xE3\x80\x81", "|", keep_empty_tokens);
+    Tok t(test_string, sep);
+    BOOST_TEST(std::distance(t.begin(), t.end()) == 5);
+    BOOST_TEST(std::equal(t.begin(), t.end(), answer));
+  }
+
+  // Same results as char_separator on ASCII input.
+  {
+    const std::string test_string = ";;Hello|world||-foo--bar;yow;baz|";
+    typedef tokenizer<char_separator<char> > CTok;
+    typedef tokenizer<utf8_separator> UTok;
+    CTok ct(test_string, char_separator<char>("-;", "|", keep_empty_tokens));
+    UTok ut(test_string, utf8_separator("-;", "|", keep_empty_tokens));
+    BOOST_TEST(std::distance(ct.begin(), ct.end()) ==
+               std::distance(ut.begin(), ut.end()));
+    BOOST_TEST(std::equal(ct.begin(), ct.end(), ut.begin()));
+  }
+
+  // Long enough for the ASCII table to be built part way through, in both
+  // modes, and for UTF-16 or UTF-32 too; copies of the separator start
+  // without a table and find the same tokens.
+  {
+    std::string s;
+    for (int r = 0; r < 3; ++r)
+      for (int c = 1; c < 128; ++c) {
+        s += static_cast<char>(c);
+        s += "ab";
+      }
+    const empty_token_policy modes[] = { drop_empty_tokens,
+                                         keep_empty_tokens };
+    for (std::size_t m = 0; m < 2; ++m) {
+      typedef tokenizer<char_separator<char> > CTok;
+      typedef tokenizer<utf8_separator> UTok;
+      CTok ct(s, char_separator<char>(" -;", "|;.", modes[m]));
+      utf8_separator sep(" -;", "|;.", modes[m]);
+      UTok ut(s, sep);
+      BOOST_TEST(std::vector<std::string>(ut.begin(), ut.end()) ==
+                 std::vector<std::string>(ct.begin(), ct.end()));
+      UTok again(s, ut.begin().tokenizer_function());
+      BOOST_TEST(std::vector<std::string>(again.begin(), again.end()) ==
+                 std::vector<std::string>(ct.begin(), ct.end()));
+    }
+#if !defined(BOOST_NO_STD_WSTRING)
+    const std::wstring w(s.begin(), s.end());
+    typedef tokenizer<char_separator<wchar_t>,
+                      std::wstring::const_iterator, std::wstring> CTok;
+    typedef tokenizer<unicode_separator<wchar_t>,
+                      std::wstring::const_iterator, std::wstring> UTok;
+    CTok ct(w, char_separator<wchar_t>(L" -;", L"|;."));
+    UTok ut(w, unicode_separator<wchar_t>(L" -;", L"|;."));
+    BOOST_TEST(std::vector<std::wstring>(ut.begin(), ut.end()) ==
+               std::vector<std::wstring>(ct.begin(), ct.end()));
+#endif
+  }
+
+  // A delimiter in both lists is kept with keep_empty_tokens, as it is by
+  // char_separator, and dropped otherwise.
+  {
+    const std::string test_string = "a^^b";
+    std::string kept[] = { "a", "^", "", "^", "b" };
+    std::string dropped[] = { "a", "b" };
+    typedef tokenizer<utf8_separator> Tok;
+    Tok k(test_string, utf8_separator("^", "^", keep_empty_tokens));
+    BOOST_TEST(std::distance(k.begin(), k.end()) == 5);
+    BOOST_TEST(std::equal(k.begin(), k.end(), kept));
+    Tok d(test_string, utf8_separator("^", "^"));
+    BOOST_TEST(std::distance(d.begin(), d.end()) == 2);
+    BOOST_TEST(std::equal(d.begin(), d.end(), dropped));
+  }
+
+  // A separator reused across inputs starts each one afresh.
+  {
+    const std::string inputs[] = { "a", ",c" };
+    token_batch<char> batch;
+    tokenize_batch(inputs, inputs + 2,
+                   unicode_separator<char>(",", 0, keep_empty_tokens), batch);
+    BOOST_TEST_EQ(batch.size(), 2u);
+    BOOST_TEST_EQ(batch.tokens_of(0).second - batch.tokens_of(0).first, 1u);
+    BOOST_TEST(batch.token(batch.tokens_of(0).first) == "a");
+    BOOST_TEST_EQ(batch.tokens_of(1).second - batch.tokens_of(1).first, 2u);
+    BOOST_TEST(batch.token(batch.tokens_of(1).first) == "");
+    BOOST_TEST(batch.token(batch.tokens_of(1).first + 1) == "c");
+  }
+
+  // Malformed UTF-8 stays inside the token.
+  {
+    const std::string test_string = "ab\xE3\x80 cd\xFF";
+    std::string answer[] = { "ab\xE3\x80", "cd\xFF" };
+    typedef tokenizer<utf8_separator> Tok;
+    Tok t(test_string);
+    BOOST_TEST(std::distance(t.begin(), t.end()) == 2);
+    BOOST_TEST(std::equal(t.begin(), t.end(), answer));
+  }
+
+#if !defined(BOOST_NO_STD_WSTRING)
+  // Wide characters are classified without the C library.
+  {
+    const std::wstring test_string = L"\u00BFQu\u00E9?\u2003s\u00ED";
+    std::wstring answer[] = { L"\u00BF", L"Qu\u00E9", L"?", L"s\u00ED" };
+    typedef tokenizer<unicode_separator<wchar_t>,
+                      std::wstring::const_iterator, std::wstring> Tok;
+    Tok t(test_string);
+    BOOST_TEST(std::distance(t.begin(), t.end()) == 4);
+    BOOST_TEST(std::equal(t.begin(), t.end(), answer));
+  }
+#endif
+
+  return boost::report_errors();
+}
@@ -0,0 +1,125 @@
+// Boost tokenizer word_tokenizer tests  ------------------------------------//
+
+// Copyright 2026 Boost.Tokenizer contributors.
+
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// See http://www.boost.org for updates, documentation, and revision history.
+
+#include <boost/tokenizer/word_tokenizer.hpp>
+
+#include <cctype>
+#include <cstddef>
+#include <list>
+#include <string>
+#include <vector>
+#include <boost/tokenizer.hpp>
+#include <boost/core/lightweight_test.hpp>
+
+namespace {
+
+  typedef std::vector<std::string> strings;
+
+  strings views(const std::string& s)
+  {
+    boost::word_view_tokenizer t(s);
+    strings v;
+    for (boost::word_view_tokenizer::iterator it = t.begin(); it != t.end();
+         ++it)
+      v.push_back(it->str());
+    return v;
+  }
+
+} // namespace
+
+int main()
+{
+  using namespace boost;
+
+  // The same tokens as tokenizer<>.
+  const char* inputs[] = {
+    "", " ", "a", ".", "This is,  a test", "Hello, world! (It's) 3.14;x",
+    "\t\ntabs\vand\fnew\rlines\n", "a-b_c@d#e$f%g^h&i*j+k=l|m~n`o/p\\q"
+  };
+  for (std::size_t i = 0; i < sizeof(inputs) / sizeof(inputs[0]); ++i) {
+    std::string s = inputs[i];
+    tokenizer<> legacy(s);
+    strings expected(legacy.begin(), legacy.end());
+    word_tokenizer words(s);
+    BOOST_TEST(strings(words.begin(), words.end()) == expected);
+    BOOST_TEST(views(s) == expected);
+
+    std::list<char> l(s.begin(), s.end());
+    tokenizer<word_separator<char>, std::list<char>::const_iterator>
+      from_list(l);
+    BOOST_TEST(strings(from_list.begin(), from_list.end()) == expected);
+  }
+
+  // Every single byte character is classified as by isspace and ispunct.
+  {
+    std::string s;
+    for (int c = 1; c < 128; ++c) {
+      s += static_cast<char>(c);
+      s += 'x';
+    }
+    tokenizer<> legacy(s);
+    word_tokenizer words(s);
+    BOOST_TEST(strings(words.begin(), words.end()) ==
+               strings(legacy.begin(), legacy.end()));
+  }
+
+  // Long enough for the table to be built part way through, and checked
+  // against isspace and ispunct directly, with the bytes above 127 given
+  // to them as unsigned char, as both separators must.
+  {
+    std::string s;
+    for (int r = 0; r < 3; ++r)
+      for (int c = 1; c < 256; ++c) {
+        s += static_cast<char>(c);
+        s += "xy";
+      }
+    strings expected;
+    std::string word;
+    for (std::size_t i = 0; i <= s.size(); ++i) {
+      if (i == s.size() || std::isspace(static_cast<unsigned char>(s[i])) ||
+          std::ispunct(static_cast<unsigned char>(s[i]))) {
+        if (!word.empty())
+          expected.push_back(word);
+        word.clear();
+      }
+      else
+        word += s[i];
+    }
+    tokenizer<> legacy(s);
+    word_tokenizer words(s);
+    BOOST_TEST(strings(legacy.begin(), legacy.end()) == expected);
+    BOOST_TEST(strings(words.begin(), words.end()) == expected);
+    BOOST_TEST(views(s) == expected);
+  }
+
+  // Wide characters, which have no table.
+  {
+    std::wstring s = L"wide, text;  here";
+    tokenizer<char_delimiters_separator<wchar_t>,
+              std::wstring::const_iterator, std::wstring> legacy(s);
+    tokenizer<word_separator<wchar_t>, std::wstring::const_iterator,
+              std::wstring> words(s);
+    BOOST_TEST(std::vector<std::wstring>(words.begin(), words.end()) ==
+               std::vector<std::wstring>(legacy.begin(), legacy.end()));
+  }
+
+  // The table of char_delimiters_separator follows its lists.
+  {
+    std::string s = "a;b c|d";
+    char_delimiters_separator<char> sep(true, "|;", " ");
+    tokenizer<char_delimiters_separator<char> > t(s, sep);
+    strings v(t.begin(), t.end());
+    BOOST_TEST_EQ(v.size(), 6u);
+    BOOST_TEST_EQ(v[1], ";");
+    BOOST_TEST_EQ(v[4], "|");
+  }
+
+  return boost::report_errors();
+}